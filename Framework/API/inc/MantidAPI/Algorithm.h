@@ -179,6 +179,15 @@ public:
   /// Override if the algorithm is not part of the Mantid distribution.
   const std::string helpURL() const override { return ""; }
 
+  /// Override to return true if the outputs depend only on the values of the
+  /// input properties and the content of the input workspaces. The results of
+  /// such algorithms can be reused, see AlgorithmResultCache.
+  virtual bool isPure() const { return false; }
+  /// Override to return false if the outputs of a pure algorithm do not depend
+  /// on the counts (Y and E) or run logs of its input workspaces, so that runs
+  /// differing only in those reuse the same results.
+  virtual bool dependsOnInputCounts() const { return true; }
+
   template <typename T, typename = typename std::enable_if<std::is_convertible<T *, MatrixWorkspace *>::value>::type>
   std::tuple<std::shared_ptr<T>, Indexing::SpectrumIndexSet> getWorkspaceAndIndices(const std::string &name) const;
 
@@ -276,6 +285,11 @@ public:
   void setupAsChildAlgorithm(const Algorithm_sptr &algorithm, const double startProgress = -1.,
                              const double endProgress = -1., const bool enableLogging = true);
 
+  /// Set the number of threads this algorithm may use. 0 removes the limit.
+  void setThreadBudget(const int budget) { m_threadBudget = budget; }
+  /// The number of threads this algorithm may use, 0 if it is not limited
+  int threadBudget() const { return m_threadBudget; }
+
   /// set whether we wish to track the child algorithm's history and pass it the
   /// parent object to fill.
   void trackAlgorithmHistory(std::shared_ptr<AlgorithmHistory> parentHist);
@@ -457,6 +471,7 @@ private:
   void logAlgorithmInfo() const;
 
   bool executeInternal();
+  void runExec();
 
   bool executeAsyncImpl(const Poco::Void &i);
 
@@ -496,6 +511,7 @@ private:
   mutable double m_endChildProgress;                        ///< Keeps value for algorithm's progress
                                                             /// at Child Algorithm's finish
   AlgorithmID m_algorithmID;                                ///< Algorithm ID for managed algorithms
+  int m_threadBudget;                                       ///< Threads granted by the parent algorithm
   std::vector<std::weak_ptr<IAlgorithm>> m_ChildAlgorithms; ///< A list of
                                                             /// weak pointers
                                                             /// to any child
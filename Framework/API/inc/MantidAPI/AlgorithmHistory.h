@@ -58,7 +58,7 @@ public:
                    const unsigned int &direction = 99);
 
   /// add a child algorithm history record to this history object
-  void addChildHistory(const AlgorithmHistory_sptr &childHist);
+  void addChildHistory(const AlgorithmHistory_sptr &childHist, const bool compact = false);
   // get functions
   /// get name of algorithm in history const
   const std::string &name() const { return m_name; }
@@ -72,6 +72,12 @@ public:
   const std::size_t &execCount() const { return m_execCount; }
   /// get the uuid
   const std::string &uuid() const { return m_uuid; }
+  /// get the number of consecutive identical executions this record stands for
+  std::size_t repeatCount() const { return m_repeatCount; }
+  /// Set the number of consecutive identical executions this record stands for
+  void setRepeatCount(std::size_t repeatCount) { m_repeatCount = repeatCount; }
+  /// Check if this record describes the same execution as another one
+  bool isRepeatOf(const AlgorithmHistory &other) const;
   /// get parameter list of algorithm in history const
   const Mantid::Kernel::PropertyHistories &getProperties() const { return m_properties; }
   /// get the string representation of a specified property
@@ -132,6 +138,8 @@ private:
   std::string m_uuid;
   /// If algorithm was set to store workspaces in the ADS
   bool m_storeInADS{true};
+  /// Number of consecutive identical executions collapsed into this record
+  std::size_t m_repeatCount{1};
 };
 
 MANTID_API_DLL std::ostream &operator<<(std::ostream &, const AlgorithmHistory &);
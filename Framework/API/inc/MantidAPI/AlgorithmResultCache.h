@@ -0,0 +1,100 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+#include "MantidAPI/Workspace_fwd.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace Mantid {
+namespace API {
+class Algorithm;
+
+/** AlgorithmResultCacheImpl : keeps the outputs of algorithms that declare
+ * themselves pure (see Algorithm::isPure) so that running one again on the
+ * same inputs can reuse them instead of calling exec().
+ *
+ * Results are keyed on the algorithm name and version, the values of its
+ * input properties and a SHA-1 fingerprint of the content of its input
+ * workspaces. Only MatrixWorkspaces can be fingerprinted; an algorithm with any
+ * other type of input workspace is always executed. The fingerprint covers the
+ * binning, units, spectrum to detector mapping, sample and instrument. It also
+ * covers the counts and the run logs unless the algorithm does not depend on
+ * them (see Algorithm::dependsOnInputCounts), in which case the reused outputs
+ * keep the logs of the run they were calculated from. The history is not
+ * included, so identical workspaces created separately share their results.
+ *
+ * Stored workspaces are copies, so changes made to the outputs later on do not
+ * alter the cache. The least recently used results are dropped once the
+ * stored workspaces use more than algorithms.memoize.maxmemory MB. The cache
+ * is disabled when that is 0, which is the default.
+ */
+class MANTID_API_DLL AlgorithmResultCacheImpl {
+public:
+  /// The outputs of one execution of an algorithm
+  struct Result {
+    /// Values of output properties that are not workspaces
+    std::map<std::string, std::string> values;
+    /// Copies of the output workspaces
+    std::map<std::string, Workspace_sptr> workspaces;
+  };
+
+  bool enabled() const;
+  std::optional<std::string> key(const Algorithm &alg) const;
+  std::shared_ptr<const Result> find(const std::string &key);
+  void insert(const std::string &key, const Algorithm &alg);
+  bool restore(Algorithm &alg, const Result &result) const;
+  static std::optional<std::string> fingerprint(const Workspace &workspace, const bool withCounts = true);
+
+  /// @return the number of stored results
+  size_t size() const;
+  void clear();
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<AlgorithmResultCacheImpl>;
+
+  AlgorithmResultCacheImpl() = default;
+  ~AlgorithmResultCacheImpl() = default;
+  AlgorithmResultCacheImpl(const AlgorithmResultCacheImpl &) = delete;
+  AlgorithmResultCacheImpl &operator=(const AlgorithmResultCacheImpl &) = delete;
+
+  size_t maxMemory() const;
+  void evict(const size_t maxMemory);
+
+  struct Entry {
+    std::string key;
+    std::shared_ptr<const Result> result;
+    size_t memory;
+  };
+  /// Stored results, most recently used first
+  std::list<Entry> m_entries;
+  /// Lookup from a key to its entry
+  std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+  /// Memory used by the stored workspaces in bytes
+  size_t m_memory{0};
+  /// Protects all of the above
+  mutable std::mutex m_mutex;
+};
+
+using AlgorithmResultCache = Mantid::Kernel::SingletonHolder<AlgorithmResultCacheImpl>;
+
+} // namespace API
+} // namespace Mantid
+
+namespace Mantid {
+namespace Kernel {
+EXTERN_MANTID_API template class MANTID_API_DLL Mantid::Kernel::SingletonHolder<Mantid::API::AlgorithmResultCacheImpl>;
+}
+} // namespace Mantid
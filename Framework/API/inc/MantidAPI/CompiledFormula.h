@@ -0,0 +1,91 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/DllConfig.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+/** CompiledFormula : a muParser formula compiled for evaluation over whole
+ * arrays of one of its variables.
+ *
+ * The formula is parsed once into an expression tree, and its derivatives
+ * with respect to the scalar variables are formed symbolically from the same
+ * tree. The trees are flattened into lists of instructions which are run over
+ * blocks of points, so that every instruction is a tight loop the compiler can
+ * vectorise. Subexpressions that do not depend on the array variable are
+ * evaluated once per call.
+ *
+ * Only numbers, the constants _pi and _e, the operators + - * / ^, brackets
+ * and the muParser functions of one argument are supported. Any other formula
+ * is rejected with std::invalid_argument so that the caller can fall back to
+ * muParser. So are formulas whose meaning depends on the muParser version,
+ * which are those with a sign in front of a power (-x^2) or chained powers
+ * (x^2^3).
+ */
+class MANTID_API_DLL CompiledFormula {
+public:
+  CompiledFormula(const std::string &formula, const std::string &arrayVariable,
+                  const std::vector<std::string> &scalarVariables);
+
+  /// The number of scalar variables
+  size_t numberOfScalars() const { return m_numberOfScalars; }
+  void evaluate(const double *x, const size_t n, const double *scalars, double *out) const;
+  void evaluateDerivatives(const double *x, const size_t n, const double *scalars,
+                           const std::vector<double *> &out) const;
+
+  /// A node of an expression tree, defined in the implementation
+  struct Node;
+
+private:
+  /// MultiplyNonZero is a product that is zero whenever its first operand is
+  /// zero, even if the second one is infinite
+  enum class Operation : uint8_t { Add, Subtract, Multiply, MultiplyNonZero, Divide, Power, Negate, Function };
+  /// An input of an instruction: the array variable, a block of intermediate
+  /// results or a scalar
+  struct Operand {
+    bool isArray;
+    /// For arrays, 0 is the array variable and i > 0 is the block of register
+    /// i. For scalars, the index of the scalar slot.
+    uint32_t index;
+  };
+  struct Instruction {
+    Operation operation;
+    double (*function)(double);
+    uint32_t result;
+    Operand first;
+    Operand second;
+  };
+  /// The instructions computing a set of outputs
+  struct Program {
+    /// Instructions on scalars, run once per call
+    std::vector<Instruction> scalarCode;
+    /// Instructions on blocks of points
+    std::vector<Instruction> arrayCode;
+    std::vector<Operand> outputs;
+    /// Initial values of the scalar slots, which start with the variables
+    /// followed by the constants
+    std::vector<double> scalarSlots;
+    uint32_t numberOfRegisters = 0;
+  };
+  static Operand compile(const Node &node, Program &program,
+                         std::vector<std::pair<const Node *, Operand>> &compiled);
+  void run(const Program &program, const double *x, const size_t n, const double *scalars,
+           double *const *out) const;
+
+  size_t m_numberOfScalars;
+  Program m_values;
+  Program m_derivatives;
+};
+
+} // namespace API
+} // namespace Mantid
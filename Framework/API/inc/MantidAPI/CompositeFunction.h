@@ -156,6 +156,8 @@ public:
   [[nodiscard]] std::vector<std::shared_ptr<IFunction>> createEquivalentFunctions() const override;
   /// Returns true if the composite has at least one of this function.
   [[nodiscard]] bool hasFunction(const std::string &functionName) const;
+  /// Returns true if all member functions are thread safe
+  [[nodiscard]] bool threadSafe() const override;
   /// Returns the pointer to i-th function
   [[nodiscard]] IFunction_sptr getFunction(std::size_t i) const override;
   /// Number of functions
@@ -51,6 +51,11 @@ public:
   /// Finalize minimization, eg store additional outputs
   virtual void finalize() {}
 
+  /// Whether separate instances can minimize at the same time. Minimizers that
+  /// share state between instances, eg an output in the AnalysisDataService,
+  /// return false.
+  virtual bool canRunConcurrently() const { return true; }
+
 protected:
   /// Error string.
   std::string m_errorString;
@@ -639,6 +639,10 @@ public:
   void setParallel(bool on) { m_isParallel = on; }
   /// Get the parallel hint
   [[nodiscard]] bool isParallel() const { return m_isParallel; }
+  /// Whether this function can be evaluated on one thread while other
+  /// functions are evaluated on other threads. Functions that keep no state
+  /// shared with other instances opt in by overriding this.
+  [[nodiscard]] virtual bool threadSafe() const { return false; }
 
   /// Set a function handler
   void setHandler(std::unique_ptr<FunctionHandler> handler);
@@ -11,6 +11,7 @@
 //----------------------------------------------------------------------
 #include "MantidAPI/CompositeFunction.h"
 
+#include <functional>
 #include <map>
 
 namespace Mantid {
@@ -74,6 +75,7 @@ protected:
   /// Counts number of the domains
   void countNumberOfDomains();
   void countValueOffsets(const CompositeDomain &domain) const;
+  void forEachMember(const std::function<void(size_t)> &evaluate) const;
 
   /// Domain index map: finction -> domain
   std::map<size_t, std::vector<size_t>> m_domains;
@@ -83,6 +85,18 @@ protected:
   /// Maximum domain index
   size_t m_maxIndex;
   mutable std::vector<size_t> m_valueOffsets;
+
+private:
+  const std::vector<char> &sharedMembers() const;
+
+  /// All functions inside the members when the shared members were last found
+  mutable std::vector<const IFunction *> m_memberFunctions;
+  /// Where the functions of each member start in m_memberFunctions
+  mutable std::vector<size_t> m_memberFunctionOffsets;
+  /// Non-zero for each member that shares a function with another member
+  mutable std::vector<char> m_isSharedMember;
+  /// Reused to collect the current member functions without reallocating
+  mutable std::vector<const IFunction *> m_memberFunctionsScratch;
 };
 
 } // namespace API
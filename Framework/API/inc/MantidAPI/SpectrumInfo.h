@@ -76,6 +76,12 @@ public:
   bool hasDetectors(const size_t index) const;
   bool hasUniqueDetector(const size_t index) const;
 
+  const std::vector<double> &l2s() const;
+  const std::vector<double> &twoThetas() const;
+  const std::vector<double> &signedTwoThetas() const;
+  const std::vector<double> &azimuthals() const;
+  const std::vector<double> &difcsUncalibrated() const;
+
   void setMasked(const size_t index, bool masked);
 
   // This is likely to be deprecated/removed with the introduction of
@@ -104,12 +110,19 @@ public:
 private:
   const Geometry::IDetector &getDetector(const size_t index) const;
   const SpectrumDefinition &checkAndGetSpectrumDefinition(const size_t index) const;
+  struct CachedValues;
+  enum class CachedQuantity { L2, TwoTheta, SignedTwoTheta, Azimuthal, DifcUncalibrated };
+  const std::vector<double> &cachedValues(const CachedQuantity quantity) const;
+  double computeValue(const CachedQuantity quantity, const size_t index) const;
 
   const ExperimentInfo &m_experimentInfo;
   Geometry::DetectorInfo &m_detectorInfo;
   const Beamline::SpectrumInfo &m_spectrumInfo;
   mutable std::vector<std::shared_ptr<const Geometry::IDetector>> m_lastDetector;
   mutable std::vector<size_t> m_lastIndex;
+  /// Values for all spectra returned by l2s() etc. Shared by copies, which
+  /// look at the same geometry.
+  std::shared_ptr<CachedValues> m_cachedValues;
 };
 
 using SpectrumInfoIt = SpectrumInfoIterator<SpectrumInfo>;
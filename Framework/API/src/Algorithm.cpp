@@ -8,6 +8,7 @@
 #include "MantidAPI/ADSValidator.h"
 #include "MantidAPI/AlgorithmHistory.h"
 #include "MantidAPI/AlgorithmManager.h"
+#include "MantidAPI/AlgorithmResultCache.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/DeprecatedAlgorithm.h"
 #include "MantidAPI/DeprecatedAlias.h"
@@ -23,6 +24,7 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/Strings.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/UsageService.h"
 
@@ -114,8 +116,8 @@ Algorithm::Algorithm()
       m_executionState(ExecutionState::Uninitialized), m_resultState(ResultState::NotFinished),
       m_isChildAlgorithm(false), m_recordHistoryForChild(false), m_alwaysStoreInADS(true), m_runningAsync(false),
       m_rethrow(false), m_isAlgStartupLoggingEnabled(true), m_startChildProgress(0.), m_endChildProgress(0.),
-      m_algorithmID(this), m_singleGroup(-1), m_groupsHaveSimilarNames(false), m_inputWorkspaceHistories(),
-      m_properties() {}
+      m_algorithmID(this), m_threadBudget(0), m_singleGroup(-1), m_groupsHaveSimilarNames(false),
+      m_inputWorkspaceHistories(), m_properties() {}
 
 /// Virtual destructor
 Algorithm::~Algorithm() = default;
@@ -664,7 +666,7 @@ bool Algorithm::executeInternal() {
 
       startTime = Mantid::Types::Core::DateAndTime::getCurrentTime();
       // Call the concrete algorithm's exec method
-      this->exec();
+      runExec();
       registerFeatureUsage();
       // Check for a cancellation request in case the concrete algorithm doesn't
       interruption_point();
@@ -784,6 +786,36 @@ bool Algorithm::executeInternal() {
   return isExecuted();
 }
 
+//---------------------------------------------------------------------------------------------
+/** Call exec() under the thread budget of this algorithm. Child algorithms
+ * share the threads of their parent so nested parallel work does not
+ * oversubscribe. Pure algorithms reuse the outputs of an identical earlier
+ * execution if the AlgorithmResultCache has them.
+ */
+void Algorithm::runExec() {
+  const auto execUnderBudget = [this]() {
+    ThreadBudget::execute(ThreadBudget::forNestedWork(m_threadBudget), [this]() { this->exec(); });
+  };
+  auto &resultCache = AlgorithmResultCache::Instance();
+  if (!isPure() || !resultCache.enabled()) {
+    execUnderBudget();
+    return;
+  }
+
+  const auto key = resultCache.key(*this);
+  if (!key) {
+    execUnderBudget();
+    return;
+  }
+  const auto result = resultCache.find(*key);
+  if (result && resultCache.restore(*this, *result)) {
+    getLogger().information() << "Reused the outputs of an identical earlier execution of " << name() << '\n';
+    return;
+  }
+  execUnderBudget();
+  resultCache.insert(*key, *this);
+}
+
 //---------------------------------------------------------------------------------------------
 /** Execute as a Child Algorithm.
  * This runs execute() but catches errors so as to log the name
@@ -880,6 +912,8 @@ void Algorithm::setupAsChildAlgorithm(const Algorithm_sptr &alg, const double st
   // set as a child
   alg->setChild(true);
   alg->setLogging(enableLogging);
+  // share the threads granted to this algorithm with the child
+  alg->setThreadBudget(ThreadBudget::granted() > 0 ? ThreadBudget::granted() : m_threadBudget);
 
   // Initialise the Child Algorithm
   try {
@@ -1052,7 +1086,7 @@ void Algorithm::linkHistoryWithLastChild() {
     const auto &childHistories = m_history->getChildHistories();
     auto childIter = childHistories.rbegin();
     for (; childIter != childHistories.rend() && !linked; ++childIter) {
-      const auto &props = (*childIter)->getProperties();
+      auto &props = (*childIter)->m_properties;
       auto propIter = props.begin();
       for (; propIter != props.end() && !linked; ++propIter) {
         // check we have a workspace property
@@ -1062,6 +1096,9 @@ void Algorithm::linkHistoryWithLastChild() {
           std::ostringstream os;
           os << "__TMP" << wsProp->getWorkspace().get();
           if (os.str() == (*propIter)->value()) {
+            // compact histories share property histories between children so
+            // take a copy before changing it
+            *propIter = std::make_shared<Kernel::PropertyHistory>(**propIter);
             (*propIter)->setValue(prop->value());
             linked = true;
           }
@@ -1376,7 +1413,9 @@ void Algorithm::fillHistory(const std::vector<Workspace_sptr> &outputWorkspaces)
   }
   // this is a child algorithm, but we still want to keep the history.
   else if (m_recordHistoryForChild && m_parentHistory) {
-    m_parentHistory->addChildHistory(m_history);
+    const bool compact =
+        Kernel::ConfigService::Instance().getValue<bool>("algorithms.history.compact").value_or(false);
+    m_parentHistory->addChildHistory(m_history, compact);
   }
 }
 
@@ -134,17 +134,61 @@ void AlgorithmHistory::addProperty(const std::string &name, const std::string &v
 }
 
 /** Add a child algorithm history to history
+ *
+ * In compact mode a child that repeats the previous child exactly is not
+ * stored; the count of the previous record is increased instead. Otherwise
+ * any property histories that are unchanged from the previous child of the
+ * same algorithm are shared with it rather than kept as separate copies.
+ *
  *  @param childHist :: The child history
+ *  @param compact :: If true, collapse repeats and share unchanged properties
  */
-void AlgorithmHistory::addChildHistory(const AlgorithmHistory_sptr &childHist) {
+void AlgorithmHistory::addChildHistory(const AlgorithmHistory_sptr &childHist, const bool compact) {
   // Don't copy one's own history onto oneself
   if (this == &(*childHist)) {
     return;
   }
 
+  if (compact && !m_childHistories.empty()) {
+    auto &previous = *m_childHistories.back();
+    if (childHist->isRepeatOf(previous)) {
+      previous.m_repeatCount += childHist->m_repeatCount;
+      if (previous.m_executionDuration >= 0. && childHist->m_executionDuration >= 0.)
+        previous.m_executionDuration += childHist->m_executionDuration;
+      return;
+    }
+    if (previous.m_name == childHist->m_name && previous.m_version == childHist->m_version &&
+        previous.m_properties.size() == childHist->m_properties.size()) {
+      auto &properties = childHist->m_properties;
+      for (size_t i = 0; i < properties.size(); ++i) {
+        const auto &previousProperty = previous.m_properties[i];
+        if (properties[i] != previousProperty && *properties[i] == *previousProperty &&
+            properties[i]->direction() == previousProperty->direction())
+          properties[i] = previousProperty;
+      }
+    }
+  }
+
   m_childHistories.emplace_back(childHist);
 }
 
+/** Check if this record describes the same execution as another one, i.e. the
+ * same algorithm run with the same property values. Records with child
+ * histories of their own are never considered repeats.
+ * @param other :: The history to compare with
+ * @returns True if the records are interchangeable
+ */
+bool AlgorithmHistory::isRepeatOf(const AlgorithmHistory &other) const {
+  if (m_name != other.m_name || m_version != other.m_version || m_storeInADS != other.m_storeInADS ||
+      !m_childHistories.empty() || !other.m_childHistories.empty() ||
+      m_properties.size() != other.m_properties.size())
+    return false;
+  return std::equal(m_properties.cbegin(), m_properties.cend(), other.m_properties.cbegin(),
+                    [](const auto &lhs, const auto &rhs) {
+                      return lhs == rhs || (*lhs == *rhs && lhs->direction() == rhs->direction());
+                    });
+}
+
 /*
  Return the child history length
  */
@@ -242,6 +286,7 @@ AlgorithmHistory &AlgorithmHistory::operator=(const AlgorithmHistory &A) {
     m_childHistories = temp;
     m_uuid = A.m_uuid;
     m_execCount = A.m_execCount;
+    m_repeatCount = A.m_repeatCount;
   }
   return *this;
 }
@@ -272,6 +317,8 @@ void AlgorithmHistory::saveNexus(Nexus::File *file, int &algCount) const {
   file->writeData("author", std::string("mantid"));
   file->writeData("description", std::string("Mantid Algorithm data"));
   file->writeData("data", algData.str());
+  if (m_repeatCount > 1)
+    file->writeData("repeat_count", static_cast<uint64_t>(m_repeatCount));
 
   // child algorithms
   for (const auto &history : m_childHistories) {
@@ -0,0 +1,314 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/Axis.h"
+#include "MantidAPI/IWorkspaceProperty.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceGroup.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Instrument/SampleEnvironment.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/MeshObject.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/Unit.h"
+
+#include <Poco/SHA1Engine.h>
+
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+
+namespace Mantid::API {
+
+using Kernel::Direction;
+
+namespace {
+/// Collects the content of a workspace into a SHA-1 digest
+class Digest {
+public:
+  template <typename T> void add(const T &value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    m_engine.update(&value, sizeof(T));
+  }
+  template <typename T> void add(const std::vector<T> &values) {
+    add(values.size());
+    m_engine.update(values.data(), values.size() * sizeof(T));
+  }
+  void add(const std::string &text) {
+    add(text.size());
+    m_engine.update(text);
+  }
+  void add(const Kernel::V3D &v) {
+    add(v.X());
+    add(v.Y());
+    add(v.Z());
+  }
+  std::string hex() { return Poco::DigestEngine::digestToHex(m_engine.digest()); }
+
+private:
+  Poco::SHA1Engine m_engine;
+};
+
+void addMaterial(Digest &digest, const Kernel::Material &material) {
+  digest.add(material.name());
+  digest.add(material.numberDensity());
+  digest.add(material.packingFraction());
+  digest.add(material.temperature());
+  digest.add(material.pressure());
+  digest.add(material.cohScatterXSection());
+  digest.add(material.totalScatterXSection());
+  digest.add(material.absorbXSection());
+}
+
+/// Add the geometry of a shape and its material to a digest
+void addShape(Digest &digest, const Geometry::IObject &shape) {
+  if (const auto *csgObject = dynamic_cast<const Geometry::CSGObject *>(&shape)) {
+    digest.add(csgObject->getShapeXML());
+  } else if (const auto *meshObject = dynamic_cast<const Geometry::MeshObject *>(&shape)) {
+    digest.add(meshObject->getV3Ds());
+    digest.add(meshObject->getTriangles());
+  }
+  // shapes without a description are told apart by their extent
+  digest.add(shape.hasValidShape());
+  if (shape.hasValidShape()) {
+    const auto &box = shape.getBoundingBox();
+    digest.add(box.minPoint());
+    digest.add(box.maxPoint());
+  }
+  addMaterial(digest, shape.material());
+}
+
+/// Add the sample, its environment and the instrument to a digest
+void addExperiment(Digest &digest, const MatrixWorkspace &workspace) {
+  const auto &sample = workspace.sample();
+  digest.add(sample.getName());
+  digest.add(sample.getGeometryFlag());
+  digest.add(sample.getThickness());
+  digest.add(sample.getHeight());
+  digest.add(sample.getWidth());
+  addShape(digest, sample.getShape());
+  digest.add(sample.hasEnvironment());
+  if (sample.hasEnvironment()) {
+    const auto &environment = sample.getEnvironment();
+    digest.add(environment.name());
+    digest.add(environment.nelements());
+    for (size_t i = 0; i < environment.nelements(); ++i) {
+      addShape(digest, environment.getComponent(i));
+    }
+  }
+
+  const auto &componentInfo = workspace.componentInfo();
+  digest.add(componentInfo.size());
+  for (size_t i = 0; i < componentInfo.size(); ++i) {
+    digest.add(componentInfo.position(i));
+    const auto rotation = componentInfo.rotation(i);
+    digest.add(rotation.real());
+    digest.add(rotation.imagI());
+    digest.add(rotation.imagJ());
+    digest.add(rotation.imagK());
+    digest.add(componentInfo.scaleFactor(i));
+  }
+  const auto &detectorInfo = workspace.detectorInfo();
+  for (size_t i = 0; i < detectorInfo.size(); ++i) {
+    digest.add(detectorInfo.isMasked(i));
+  }
+  // instrument parameters such as Efixed
+  digest.add(workspace.constInstrumentParameters().asString());
+}
+} // namespace
+
+/// @return true if the algorithms.memoize.maxmemory setting allows results to be stored
+bool AlgorithmResultCacheImpl::enabled() const { return maxMemory() > 0; }
+
+/** Create the key identifying an execution of an algorithm from its current
+ * input properties.
+ * @param alg :: the algorithm about to be executed
+ * @return the key, or nothing if one of the input workspaces can not be
+ * fingerprinted
+ */
+std::optional<std::string> AlgorithmResultCacheImpl::key(const Algorithm &alg) const {
+  std::ostringstream key;
+  key << alg.name() << " v" << alg.version() << '\n';
+  for (const auto *prop : alg.getProperties()) {
+    if (prop->direction() == Direction::Output)
+      continue;
+    key << prop->name() << '=';
+    if (const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop)) {
+      // the name of a workspace does not change the result but its content does
+      if (const auto workspace = wsProp->getWorkspace()) {
+        const auto print = fingerprint(*workspace, alg.dependsOnInputCounts());
+        if (!print)
+          return std::nullopt;
+        key << *print;
+      }
+    } else {
+      key << prop->value();
+    }
+    key << '\n';
+  }
+  return key.str();
+}
+
+/** Look up a stored result and mark it as the most recently used.
+ * @param key :: the key created for the execution
+ * @return the result or nullptr if there is none
+ */
+std::shared_ptr<const AlgorithmResultCacheImpl::Result> AlgorithmResultCacheImpl::find(const std::string &key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto found = m_index.find(key);
+  if (found == m_index.end())
+    return nullptr;
+  m_entries.splice(m_entries.begin(), m_entries, found->second);
+  return found->second->result;
+}
+
+/** Store copies of the outputs of an algorithm that has just executed. Nothing
+ * is stored if an output is a WorkspaceGroup or the outputs are larger than
+ * the cache.
+ * @param key :: the key created for the execution before it started
+ * @param alg :: the executed algorithm
+ */
+void AlgorithmResultCacheImpl::insert(const std::string &key, const Algorithm &alg) {
+  const size_t limit = maxMemory();
+  auto result = std::make_shared<Result>();
+  size_t memory = 0;
+  for (const auto *prop : alg.getProperties()) {
+    if (prop->direction() != Direction::Output && prop->direction() != Direction::InOut)
+      continue;
+    if (const auto *wsProp = dynamic_cast<const IWorkspaceProperty *>(prop)) {
+      const auto workspace = wsProp->getWorkspace();
+      if (!workspace)
+        continue;
+      // copying a group would share its members with the output
+      if (std::dynamic_pointer_cast<WorkspaceGroup>(workspace))
+        return;
+      memory += workspace->getMemorySize();
+      if (memory > limit)
+        return;
+      result->workspaces.emplace(prop->name(), Workspace_sptr(workspace->clone()));
+    } else {
+      result->values.emplace(prop->name(), prop->value());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_index.count(key) > 0)
+    return;
+  m_entries.push_front(Entry{key, std::move(result), memory});
+  m_index.emplace(key, m_entries.begin());
+  m_memory += memory;
+  evict(limit);
+}
+
+/** Set the output properties of an algorithm from a stored result. Output
+ * workspaces are new copies with an empty history, which is filled in when the
+ * algorithm completes as if it had executed.
+ * @param alg :: the algorithm to set the outputs of
+ * @param result :: the stored result
+ * @return false if the result has outputs that the algorithm only declares
+ * during execution, in which case nothing is set
+ */
+bool AlgorithmResultCacheImpl::restore(Algorithm &alg, const Result &result) const {
+  const auto declared = [&alg](const auto &output) { return alg.existsProperty(output.first); };
+  if (!std::all_of(result.workspaces.cbegin(), result.workspaces.cend(), declared) ||
+      !std::all_of(result.values.cbegin(), result.values.cend(), declared))
+    return false;
+
+  for (const auto &[name, workspace] : result.workspaces) {
+    Workspace_sptr copy(workspace->clone());
+    copy->history().clearHistory();
+    alg.getPointerToProperty(name)->setDataItem(copy);
+  }
+  for (const auto &[name, value] : result.values) {
+    alg.setPropertyValue(name, value);
+  }
+  return true;
+}
+
+/** Create a fingerprint of the content of a workspace. It covers the binning,
+ * the units, the spectrum to detector mapping, the sample and the instrument.
+ * Workspaces with the same content have the same fingerprint however they were
+ * created.
+ * @param workspace :: the workspace
+ * @param withCounts :: whether to include the counts (Y and E) and the run logs
+ * @return the fingerprint, or nothing if the type of workspace is not supported
+ */
+std::optional<std::string> AlgorithmResultCacheImpl::fingerprint(const Workspace &workspace, const bool withCounts) {
+  const auto *matrixWS = dynamic_cast<const MatrixWorkspace *>(&workspace);
+  if (!matrixWS)
+    return std::nullopt;
+
+  Digest digest;
+  digest.add(workspace.id());
+  const size_t numHist = matrixWS->getNumberHistograms();
+  digest.add(numHist);
+  const auto xUnit = matrixWS->getAxis(0)->unit();
+  digest.add(xUnit ? xUnit->unitID() : std::string());
+  digest.add(matrixWS->YUnit());
+  digest.add(matrixWS->isDistribution());
+  for (size_t i = 0; i < numHist; ++i) {
+    digest.add(matrixWS->readX(i));
+    if (withCounts) {
+      digest.add(matrixWS->readY(i));
+      digest.add(matrixWS->readE(i));
+    }
+    const auto &spectrum = matrixWS->getSpectrum(i);
+    digest.add(spectrum.getSpectrumNo());
+    const auto &detectorIDs = spectrum.getDetectorIDs();
+    digest.add(std::vector<detid_t>(detectorIDs.cbegin(), detectorIDs.cend()));
+  }
+  if (withCounts) {
+    for (const auto *log : matrixWS->run().getProperties()) {
+      digest.add(log->name());
+      digest.add(log->value());
+    }
+  }
+  addExperiment(digest, *matrixWS);
+  return digest.hex();
+}
+
+size_t AlgorithmResultCacheImpl::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+/// Remove all of the stored results
+void AlgorithmResultCacheImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_index.clear();
+  m_entries.clear();
+  m_memory = 0;
+}
+
+/// @return the maximum memory in bytes to use for stored workspaces
+size_t AlgorithmResultCacheImpl::maxMemory() const {
+  const auto maxMemoryMB = Kernel::ConfigService::Instance().getValue<int>("algorithms.memoize.maxmemory");
+  return static_cast<size_t>(std::max(0, maxMemoryMB.value_or(0))) * 1024 * 1024;
+}
+
+/** Drop the least recently used results until the stored workspaces fit in the
+ * given memory. Must be called with the lock held.
+ * @param maxMemory :: the memory limit in bytes
+ */
+void AlgorithmResultCacheImpl::evict(const size_t maxMemory) {
+  while (m_memory > maxMemory && !m_entries.empty()) {
+    const auto &oldest = m_entries.back();
+    m_memory -= oldest.memory;
+    m_index.erase(oldest.key);
+    m_entries.pop_back();
+  }
+}
+
+} // namespace Mantid::API
@@ -0,0 +1,691 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAPI/CompiledFormula.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+
+namespace Mantid::API {
+
+namespace {
+/// The number of points each instruction processes at a time
+constexpr size_t BLOCK_SIZE = 256;
+
+enum class Kind {
+  Constant,
+  ArrayVariable,
+  ScalarVariable,
+  Add,
+  Subtract,
+  Multiply,
+  MultiplyNonZero,
+  Divide,
+  Power,
+  Negate,
+  Function
+};
+
+struct FunctionInfo;
+} // namespace
+
+/// A node of an expression tree. Nodes are immutable and shared between the
+/// trees of the formula and its derivatives.
+struct CompiledFormula::Node {
+  Kind kind;
+  double value;
+  size_t index;
+  const FunctionInfo *function;
+  std::shared_ptr<const Node> first;
+  std::shared_ptr<const Node> second;
+};
+
+namespace {
+using Node = CompiledFormula::Node;
+using NodePtr = std::shared_ptr<const Node>;
+
+/// A function of one argument and a way to build its derivative
+struct FunctionInfo {
+  const char *name;
+  double (*value)(double);
+  NodePtr (*derivative)(const NodePtr &argument);
+};
+
+NodePtr constant(const double value) {
+  return std::make_shared<const Node>(Node{Kind::Constant, value, 0, nullptr, nullptr, nullptr});
+}
+
+bool isConstant(const NodePtr &node, const double value) {
+  return node->kind == Kind::Constant && node->value == value;
+}
+
+NodePtr makeNode(const Kind kind, NodePtr first, NodePtr second = nullptr) {
+  return std::make_shared<const Node>(Node{kind, 0.0, 0, nullptr, std::move(first), std::move(second)});
+}
+
+// The builders below fold constants and drop additions of zero and
+// multiplications by one, which keeps the derivative trees small
+
+NodePtr add(const NodePtr &a, const NodePtr &b) {
+  if (isConstant(a, 0.0))
+    return b;
+  if (isConstant(b, 0.0))
+    return a;
+  if (a->kind == Kind::Constant && b->kind == Kind::Constant)
+    return constant(a->value + b->value);
+  return makeNode(Kind::Add, a, b);
+}
+
+NodePtr negate(const NodePtr &a) {
+  if (a->kind == Kind::Constant)
+    return constant(-a->value);
+  if (a->kind == Kind::Negate)
+    return a->first;
+  return makeNode(Kind::Negate, a);
+}
+
+NodePtr subtract(const NodePtr &a, const NodePtr &b) {
+  if (isConstant(b, 0.0))
+    return a;
+  if (isConstant(a, 0.0))
+    return negate(b);
+  if (a->kind == Kind::Constant && b->kind == Kind::Constant)
+    return constant(a->value - b->value);
+  return makeNode(Kind::Subtract, a, b);
+}
+
+NodePtr multiply(const NodePtr &a, const NodePtr &b) {
+  if (isConstant(a, 0.0) || isConstant(b, 0.0))
+    return constant(0.0);
+  if (isConstant(a, 1.0))
+    return b;
+  if (isConstant(b, 1.0))
+    return a;
+  if (a->kind == Kind::Constant && b->kind == Kind::Constant)
+    return constant(a->value * b->value);
+  return makeNode(Kind::Multiply, a, b);
+}
+
+/// a * b, but zero wherever a is zero even if b is infinite. Used where a
+/// factor that vanishes makes the limit of the product zero.
+NodePtr multiplyNonZero(const NodePtr &a, const NodePtr &b) {
+  if (b->kind == Kind::Constant && std::isfinite(b->value))
+    return multiply(a, b);
+  if (isConstant(a, 0.0))
+    return a;
+  return makeNode(Kind::MultiplyNonZero, a, b);
+}
+
+NodePtr divide(const NodePtr &a, const NodePtr &b) {
+  if (isConstant(b, 1.0))
+    return a;
+  if (a->kind == Kind::Constant && b->kind == Kind::Constant)
+    return constant(a->value / b->value);
+  return makeNode(Kind::Divide, a, b);
+}
+
+NodePtr power(const NodePtr &a, const NodePtr &b) {
+  if (isConstant(b, 1.0))
+    return a;
+  if (a->kind == Kind::Constant && b->kind == Kind::Constant)
+    return constant(std::pow(a->value, b->value));
+  return makeNode(Kind::Power, a, b);
+}
+
+NodePtr applyFunction(const FunctionInfo &function, const NodePtr &argument) {
+  if (argument->kind == Kind::Constant)
+    return constant(function.value(argument->value));
+  return std::make_shared<const Node>(Node{Kind::Function, 0.0, 0, &function, argument, nullptr});
+}
+
+NodePtr applyFunction(const std::string &name, const NodePtr &argument);
+
+/// sqrt(1 - a^2) for the derivatives of the inverse trigonometric functions
+NodePtr sqrtOneMinusSquare(const NodePtr &a) {
+  return applyFunction("sqrt", subtract(constant(1.0), multiply(a, a)));
+}
+
+// Functions of one argument as muParser defines them. log is left out as its
+// base has changed between muParser versions.
+const FunctionInfo FUNCTIONS[] = {
+    {"sin", [](double v) { return std::sin(v); }, [](const NodePtr &a) { return applyFunction("cos", a); }},
+    {"cos", [](double v) { return std::cos(v); }, [](const NodePtr &a) { return negate(applyFunction("sin", a)); }},
+    {"tan", [](double v) { return std::tan(v); },
+     [](const NodePtr &a) {
+       const auto cosine = applyFunction("cos", a);
+       return divide(constant(1.0), multiply(cosine, cosine));
+     }},
+    {"asin", [](double v) { return std::asin(v); },
+     [](const NodePtr &a) { return divide(constant(1.0), sqrtOneMinusSquare(a)); }},
+    {"acos", [](double v) { return std::acos(v); },
+     [](const NodePtr &a) { return divide(constant(-1.0), sqrtOneMinusSquare(a)); }},
+    {"atan", [](double v) { return std::atan(v); },
+     [](const NodePtr &a) { return divide(constant(1.0), add(constant(1.0), multiply(a, a))); }},
+    {"sinh", [](double v) { return std::sinh(v); }, [](const NodePtr &a) { return applyFunction("cosh", a); }},
+    {"cosh", [](double v) { return std::cosh(v); }, [](const NodePtr &a) { return applyFunction("sinh", a); }},
+    {"tanh", [](double v) { return std::tanh(v); },
+     [](const NodePtr &a) {
+       const auto cosine = applyFunction("cosh", a);
+       return divide(constant(1.0), multiply(cosine, cosine));
+     }},
+    {"asinh", [](double v) { return std::asinh(v); },
+     [](const NodePtr &a) { return divide(constant(1.0), applyFunction("sqrt", add(multiply(a, a), constant(1.0)))); }},
+    {"acosh", [](double v) { return std::acosh(v); },
+     [](const NodePtr &a) {
+       return divide(constant(1.0), applyFunction("sqrt", subtract(multiply(a, a), constant(1.0))));
+     }},
+    {"atanh", [](double v) { return std::atanh(v); },
+     [](const NodePtr &a) { return divide(constant(1.0), subtract(constant(1.0), multiply(a, a))); }},
+    {"log2", [](double v) { return std::log2(v); },
+     [](const NodePtr &a) { return divide(constant(1.0 / M_LN2), a); }},
+    {"log10", [](double v) { return std::log10(v); },
+     [](const NodePtr &a) { return divide(constant(1.0 / M_LN10), a); }},
+    {"ln", [](double v) { return std::log(v); }, [](const NodePtr &a) { return divide(constant(1.0), a); }},
+    {"exp", [](double v) { return std::exp(v); }, [](const NodePtr &a) { return applyFunction("exp", a); }},
+    {"sqrt", [](double v) { return std::sqrt(v); },
+     [](const NodePtr &a) { return divide(constant(0.5), applyFunction("sqrt", a)); }},
+    {"sign", [](double v) { return (v < 0.0) ? -1.0 : (v > 0.0) ? 1.0 : 0.0; },
+     [](const NodePtr &) { return constant(0.0); }},
+    {"rint", [](double v) { return std::floor(v + 0.5); }, [](const NodePtr &) { return constant(0.0); }},
+    {"abs", [](double v) { return std::fabs(v); }, [](const NodePtr &a) { return applyFunction("sign", a); }},
+    {"erf", [](double v) { return std::erf(v); },
+     [](const NodePtr &a) { return multiply(constant(M_2_SQRTPI), applyFunction("exp", negate(multiply(a, a)))); }},
+    {"erfc", [](double v) { return std::erfc(v); },
+     [](const NodePtr &a) { return multiply(constant(-M_2_SQRTPI), applyFunction("exp", negate(multiply(a, a)))); }},
+};
+
+const FunctionInfo *findFunction(const std::string &name) {
+  const auto found = std::find_if(std::begin(FUNCTIONS), std::end(FUNCTIONS),
+                                  [&name](const FunctionInfo &function) { return name == function.name; });
+  return found == std::end(FUNCTIONS) ? nullptr : found;
+}
+
+NodePtr applyFunction(const std::string &name, const NodePtr &argument) {
+  return applyFunction(*findFunction(name), argument);
+}
+
+/**
+ * Differentiate an expression tree.
+ * @param node :: the root of the tree
+ * @param variable :: the index of the scalar variable
+ * @return the tree of the derivative
+ */
+NodePtr differentiate(const NodePtr &node, const size_t variable) {
+  switch (node->kind) {
+  case Kind::ScalarVariable:
+    return constant(node->index == variable ? 1.0 : 0.0);
+  case Kind::Add:
+    return add(differentiate(node->first, variable), differentiate(node->second, variable));
+  case Kind::Subtract:
+    return subtract(differentiate(node->first, variable), differentiate(node->second, variable));
+  case Kind::Multiply:
+  case Kind::MultiplyNonZero:
+    return add(multiply(differentiate(node->first, variable), node->second),
+               multiply(node->first, differentiate(node->second, variable)));
+  case Kind::Divide:
+    return subtract(divide(differentiate(node->first, variable), node->second),
+                    divide(multiply(node->first, differentiate(node->second, variable)),
+                           multiply(node->second, node->second)));
+  case Kind::Negate:
+    return negate(differentiate(node->first, variable));
+  case Kind::Power: {
+    const auto &base = node->first;
+    const auto &exponent = node->second;
+    const auto baseDerivative = differentiate(base, variable);
+    const auto exponentDerivative = differentiate(exponent, variable);
+    // b a^(b-1) a' + a^b ln(a) b'
+    const auto baseTerm = multiply(multiply(exponent, power(base, subtract(exponent, constant(1.0)))), baseDerivative);
+    if (isConstant(exponentDerivative, 0.0))
+      return baseTerm;
+    // ln(a) is infinite at a = 0, where a^b b' is zero for b > 0 and so is the
+    // limit of the second term. It is also zero wherever b' is.
+    return add(baseTerm, multiplyNonZero(multiply(node, exponentDerivative), applyFunction("ln", base)));
+  }
+  case Kind::Function: {
+    const auto argumentDerivative = differentiate(node->first, variable);
+    if (isConstant(argumentDerivative, 0.0))
+      return argumentDerivative;
+    return multiply(node->function->derivative(node->first), argumentDerivative);
+  }
+  default:
+    return constant(0.0);
+  }
+}
+
+/// A recursive descent parser for the supported subset of muParser formulas.
+/// The tree it builds follows the formula as written, without simplification.
+class FormulaParser {
+public:
+  FormulaParser(const std::string &formula, const std::string &arrayVariable,
+                const std::vector<std::string> &scalarVariables)
+      : m_formula(formula), m_arrayVariable(arrayVariable), m_scalarVariables(scalarVariables), m_position(0) {}
+
+  NodePtr parse() {
+    auto tree = expression();
+    skipSpaces();
+    if (m_position != m_formula.size())
+      fail("unexpected character");
+    return tree;
+  }
+
+private:
+  [[noreturn]] void fail(const std::string &reason) const {
+    throw std::invalid_argument("Cannot compile formula \"" + m_formula + "\": " + reason + " at position " +
+                                std::to_string(m_position));
+  }
+
+  void skipSpaces() {
+    while (m_position < m_formula.size() && std::isspace(static_cast<unsigned char>(m_formula[m_position])))
+      ++m_position;
+  }
+
+  bool accept(const char c) {
+    skipSpaces();
+    if (m_position < m_formula.size() && m_formula[m_position] == c) {
+      ++m_position;
+      return true;
+    }
+    return false;
+  }
+
+  bool isNameCharacter(const size_t i) const {
+    return i < m_formula.size() && (std::isalnum(static_cast<unsigned char>(m_formula[i])) || m_formula[i] == '_');
+  }
+
+  bool isDigit(const size_t i) const {
+    return i < m_formula.size() && std::isdigit(static_cast<unsigned char>(m_formula[i]));
+  }
+
+  NodePtr expression() {
+    auto result = term();
+    while (true) {
+      if (accept('+'))
+        result = makeNode(Kind::Add, result, term());
+      else if (accept('-'))
+        result = makeNode(Kind::Subtract, result, term());
+      else
+        return result;
+    }
+  }
+
+  NodePtr term() {
+    bool isPower(false);
+    auto result = signedFactor(isPower);
+    while (true) {
+      if (accept('*'))
+        result = makeNode(Kind::Multiply, result, signedFactor(isPower));
+      else if (accept('/'))
+        result = makeNode(Kind::Divide, result, signedFactor(isPower));
+      else
+        return result;
+    }
+  }
+
+  /// A factor with any number of signs. isPower is set if the factor is a
+  /// power outside brackets.
+  NodePtr signedFactor(bool &isPower) {
+    const bool isNegative = accept('-');
+    if (isNegative || accept('+')) {
+      auto operand = signedFactor(isPower);
+      if (isPower)
+        fail("a sign in front of a power is ambiguous");
+      return isNegative ? makeNode(Kind::Negate, operand) : operand;
+    }
+    return factor(isPower);
+  }
+
+  NodePtr factor(bool &isPower) {
+    auto base = primary();
+    isPower = accept('^');
+    if (!isPower)
+      return base;
+    auto exponent = primary();
+    if (accept('^'))
+      fail("chained powers are ambiguous");
+    return makeNode(Kind::Power, base, exponent);
+  }
+
+  NodePtr primary() {
+    skipSpaces();
+    if (accept('(')) {
+      auto result = expression();
+      if (!accept(')'))
+        fail("missing closing bracket");
+      return result;
+    }
+    if (isDigit(m_position) || (m_formula[m_position] == '.' && isDigit(m_position + 1)))
+      return number();
+    if (!isNameCharacter(m_position))
+      fail("expected a value");
+    const auto start = m_position;
+    while (isNameCharacter(m_position))
+      ++m_position;
+    const auto name = m_formula.substr(start, m_position - start);
+    if (accept('(')) {
+      const auto *function = findFunction(name);
+      if (!function)
+        fail("unsupported function " + name);
+      auto argument = expression();
+      if (!accept(')'))
+        fail("unsupported arguments of " + name);
+      return std::make_shared<const Node>(Node{Kind::Function, 0.0, 0, function, argument, nullptr});
+    }
+    if (name == m_arrayVariable)
+      return std::make_shared<const Node>(Node{Kind::ArrayVariable, 0.0, 0, nullptr, nullptr, nullptr});
+    const auto scalar = std::find(m_scalarVariables.cbegin(), m_scalarVariables.cend(), name);
+    if (scalar != m_scalarVariables.cend())
+      return std::make_shared<const Node>(
+          Node{Kind::ScalarVariable, 0.0, static_cast<size_t>(scalar - m_scalarVariables.cbegin()), nullptr,
+               nullptr, nullptr});
+    if (name == "_pi")
+      return constant(M_PI);
+    if (name == "_e")
+      return constant(M_E);
+    fail("unknown name " + name);
+  }
+
+  NodePtr number() {
+    const auto start = m_position;
+    while (isDigit(m_position))
+      ++m_position;
+    if (m_position < m_formula.size() && m_formula[m_position] == '.') {
+      ++m_position;
+      while (isDigit(m_position))
+        ++m_position;
+    }
+    if (m_position < m_formula.size() && (m_formula[m_position] == 'e' || m_formula[m_position] == 'E')) {
+      auto exponent = m_position + 1;
+      if (exponent < m_formula.size() && (m_formula[exponent] == '+' || m_formula[exponent] == '-'))
+        ++exponent;
+      if (isDigit(exponent)) {
+        m_position = exponent;
+        while (isDigit(m_position))
+          ++m_position;
+      }
+    }
+    if (isNameCharacter(m_position) || (m_position < m_formula.size() && m_formula[m_position] == '.'))
+      fail("malformed number");
+    return constant(std::stod(m_formula.substr(start, m_position - start)));
+  }
+
+  const std::string &m_formula;
+  const std::string &m_arrayVariable;
+  const std::vector<std::string> &m_scalarVariables;
+  size_t m_position;
+};
+
+/// Combine a block of one array with another array or a scalar
+template <typename BinaryFunction>
+void binary(double *result, const double *first, const double *second, const bool isFirstArray,
+            const bool isSecondArray, const size_t n, const BinaryFunction &function) {
+  if (isFirstArray && isSecondArray) {
+    for (size_t i = 0; i < n; ++i)
+      result[i] = function(first[i], second[i]);
+  } else if (isFirstArray) {
+    const double b = *second;
+    for (size_t i = 0; i < n; ++i)
+      result[i] = function(first[i], b);
+  } else {
+    const double a = *first;
+    for (size_t i = 0; i < n; ++i)
+      result[i] = function(a, second[i]);
+  }
+}
+
+/// Rebuild a tree with the simplifying builders
+NodePtr simplify(const NodePtr &node) {
+  switch (node->kind) {
+  case Kind::Add:
+    return add(simplify(node->first), simplify(node->second));
+  case Kind::Subtract:
+    return subtract(simplify(node->first), simplify(node->second));
+  case Kind::Multiply:
+    return multiply(simplify(node->first), simplify(node->second));
+  case Kind::MultiplyNonZero:
+    return multiplyNonZero(simplify(node->first), simplify(node->second));
+  case Kind::Divide:
+    return divide(simplify(node->first), simplify(node->second));
+  case Kind::Power:
+    return power(simplify(node->first), simplify(node->second));
+  case Kind::Negate:
+    return negate(simplify(node->first));
+  case Kind::Function:
+    return applyFunction(*node->function, simplify(node->first));
+  default:
+    return node;
+  }
+}
+} // namespace
+
+/**
+ * Compile a formula.
+ * @param formula :: a muParser formula
+ * @param arrayVariable :: the name of the variable given as an array of values
+ * @param scalarVariables :: the names of the variables given as single values,
+ * in the order they are passed to the evaluate methods
+ * @throws std::invalid_argument if the formula cannot be compiled
+ */
+CompiledFormula::CompiledFormula(const std::string &formula, const std::string &arrayVariable,
+                                 const std::vector<std::string> &scalarVariables)
+    : m_numberOfScalars(scalarVariables.size()) {
+  const auto tree = simplify(FormulaParser(formula, arrayVariable, scalarVariables).parse());
+
+  for (auto *program : {&m_values, &m_derivatives})
+    program->scalarSlots.resize(m_numberOfScalars, 0.0);
+  std::vector<std::pair<const Node *, Operand>> compiled;
+  m_values.outputs.emplace_back(compile(*tree, m_values, compiled));
+  // The derivatives share one program so that common subexpressions, such as
+  // the value of an exponential, are evaluated once
+  compiled.clear();
+  std::vector<NodePtr> derivatives;
+  for (size_t i = 0; i < m_numberOfScalars; ++i) {
+    derivatives.emplace_back(differentiate(tree, i));
+    m_derivatives.outputs.emplace_back(compile(*derivatives.back(), m_derivatives, compiled));
+  }
+}
+
+/**
+ * Evaluate the formula.
+ * @param x :: the n values of the array variable
+ * @param n :: the number of values
+ * @param scalars :: the values of the scalar variables
+ * @param out :: receives the n values of the formula
+ */
+void CompiledFormula::evaluate(const double *x, const size_t n, const double *scalars, double *out) const {
+  run(m_values, x, n, scalars, &out);
+}
+
+/**
+ * Evaluate the derivatives of the formula with respect to every scalar
+ * variable.
+ * @param x :: the n values of the array variable
+ * @param n :: the number of values
+ * @param scalars :: the values of the scalar variables
+ * @param out :: a buffer of n values for each scalar variable, which receives
+ * the derivatives with respect to that variable
+ */
+void CompiledFormula::evaluateDerivatives(const double *x, const size_t n, const double *scalars,
+                                          const std::vector<double *> &out) const {
+  if (out.size() != m_numberOfScalars)
+    throw std::invalid_argument("CompiledFormula: expected a buffer for every scalar variable");
+  run(m_derivatives, x, n, scalars, out.data());
+}
+
+/**
+ * Append the instructions computing a tree to a program. Nodes shared within
+ * the program are computed once.
+ * @param node :: the root of the tree
+ * @param program :: the program to append to
+ * @param compiled :: the operands of the nodes compiled so far
+ * @return the operand holding the value of the tree
+ */
+CompiledFormula::Operand CompiledFormula::compile(const Node &node, Program &program,
+                                                  std::vector<std::pair<const Node *, Operand>> &compiled) {
+  const auto found = std::find_if(compiled.cbegin(), compiled.cend(),
+                                  [&node](const auto &entry) { return entry.first == &node; });
+  if (found != compiled.cend())
+    return found->second;
+
+  Operand result{false, 0};
+  if (node.kind == Kind::Constant) {
+    result.index = static_cast<uint32_t>(program.scalarSlots.size());
+    program.scalarSlots.emplace_back(node.value);
+  } else if (node.kind == Kind::ArrayVariable) {
+    result.isArray = true;
+  } else if (node.kind == Kind::ScalarVariable) {
+    result.index = static_cast<uint32_t>(node.index);
+  } else {
+    Instruction instruction{Operation::Function, nullptr, 0, {false, 0}, {false, 0}};
+    switch (node.kind) {
+    case Kind::Add:
+      instruction.operation = Operation::Add;
+      break;
+    case Kind::Subtract:
+      instruction.operation = Operation::Subtract;
+      break;
+    case Kind::Multiply:
+      instruction.operation = Operation::Multiply;
+      break;
+    case Kind::MultiplyNonZero:
+      instruction.operation = Operation::MultiplyNonZero;
+      break;
+    case Kind::Divide:
+      instruction.operation = Operation::Divide;
+      break;
+    case Kind::Power:
+      instruction.operation = Operation::Power;
+      break;
+    case Kind::Negate:
+      instruction.operation = Operation::Negate;
+      break;
+    default:
+      instruction.function = node.function->value;
+    }
+    instruction.first = compile(*node.first, program, compiled);
+    if (node.second)
+      instruction.second = compile(*node.second, program, compiled);
+    result.isArray = instruction.first.isArray || instruction.second.isArray;
+    if (result.isArray) {
+      result.index = ++program.numberOfRegisters;
+      instruction.result = result.index;
+      program.arrayCode.emplace_back(instruction);
+    } else {
+      result.index = static_cast<uint32_t>(program.scalarSlots.size());
+      program.scalarSlots.emplace_back(0.0);
+      instruction.result = result.index;
+      program.scalarCode.emplace_back(instruction);
+    }
+  }
+  compiled.emplace_back(&node, result);
+  return result;
+}
+
+/**
+ * Run a program.
+ * @param program :: the program
+ * @param x :: the n values of the array variable
+ * @param n :: the number of values
+ * @param scalars :: the values of the scalar variables
+ * @param out :: a buffer of n values for each output of the program
+ */
+void CompiledFormula::run(const Program &program, const double *x, const size_t n, const double *scalars,
+                          double *const *out) const {
+  auto slots = program.scalarSlots;
+  std::copy(scalars, scalars + m_numberOfScalars, slots.begin());
+  for (const auto &instruction : program.scalarCode) {
+    const double a = slots[instruction.first.index];
+    const double b = slots[instruction.second.index];
+    double &result = slots[instruction.result];
+    switch (instruction.operation) {
+    case Operation::Add:
+      result = a + b;
+      break;
+    case Operation::Subtract:
+      result = a - b;
+      break;
+    case Operation::Multiply:
+      result = a * b;
+      break;
+    case Operation::MultiplyNonZero:
+      result = a == 0.0 ? 0.0 : a * b;
+      break;
+    case Operation::Divide:
+      result = a / b;
+      break;
+    case Operation::Power:
+      result = std::pow(a, b);
+      break;
+    case Operation::Negate:
+      result = -a;
+      break;
+    case Operation::Function:
+      result = instruction.function(a);
+      break;
+    }
+  }
+
+  std::vector<double> registers(program.numberOfRegisters * BLOCK_SIZE);
+  for (size_t start = 0; start < n; start += BLOCK_SIZE) {
+    const auto blockSize = std::min(BLOCK_SIZE, n - start);
+    const auto address = [&](const Operand &operand) -> const double * {
+      if (!operand.isArray)
+        return &slots[operand.index];
+      return operand.index == 0 ? x + start : registers.data() + (operand.index - 1) * BLOCK_SIZE;
+    };
+    for (const auto &instruction : program.arrayCode) {
+      const double *a = address(instruction.first);
+      const double *b = address(instruction.second);
+      const bool isFirstArray = instruction.first.isArray;
+      const bool isSecondArray = instruction.second.isArray;
+      double *result = registers.data() + (instruction.result - 1) * BLOCK_SIZE;
+      switch (instruction.operation) {
+      case Operation::Add:
+        binary(result, a, b, isFirstArray, isSecondArray, blockSize, [](double u, double v) { return u + v; });
+        break;
+      case Operation::Subtract:
+        binary(result, a, b, isFirstArray, isSecondArray, blockSize, [](double u, double v) { return u - v; });
+        break;
+      case Operation::Multiply:
+        binary(result, a, b, isFirstArray, isSecondArray, blockSize, [](double u, double v) { return u * v; });
+        break;
+      case Operation::MultiplyNonZero:
+        binary(result, a, b, isFirstArray, isSecondArray, blockSize,
+               [](double u, double v) { return u == 0.0 ? 0.0 : u * v; });
+        break;
+      case Operation::Divide:
+        binary(result, a, b, isFirstArray, isSecondArray, blockSize, [](double u, double v) { return u / v; });
+        break;
+      case Operation::Power:
+        if (!isSecondArray && *b == 2.0)
+          binary(result, a, b, true, false, blockSize, [](double u, double) { return u * u; });
+        else
+          binary(result, a, b, isFirstArray, isSecondArray, blockSize,
+                 [](double u, double v) { return std::pow(u, v); });
+        break;
+      case Operation::Negate:
+        for (size_t i = 0; i < blockSize; ++i)
+          result[i] = -a[i];
+        break;
+      case Operation::Function:
+        for (size_t i = 0; i < blockSize; ++i)
+          result[i] = instruction.function(a[i]);
+        break;
+      }
+    }
+    for (size_t i = 0; i < program.outputs.size(); ++i) {
+      const auto &output = program.outputs[i];
+      if (output.isArray)
+        std::copy_n(address(output), blockSize, out[i] + start);
+      else
+        std::fill_n(out[i] + start, blockSize, slots[output.index]);
+    }
+  }
+}
+
+} // namespace Mantid::API
@@ -654,6 +654,15 @@ bool CompositeFunction::hasFunction(const std::string &functionName) const {
   });
 }
 
+/**
+ * @returns true if all member functions can be evaluated concurrently with
+ * other functions.
+ */
+bool CompositeFunction::threadSafe() const {
+  return std::all_of(m_functions.cbegin(), m_functions.cend(),
+                     [](const IFunction_const_sptr &function) { return function->threadSafe(); });
+}
+
 /**
  * @param i :: The index of the function
  * @return function at the requested index
@@ -11,12 +11,22 @@
 #include "MantidAPI/CompositeDomain.h"
 #include "MantidAPI/Expression.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <algorithm>
 #include <boost/lexical_cast.hpp>
+#include <exception>
 #include <set>
 
 namespace Mantid::API {
+namespace {
+/// Collect a function and, if it is a composite, all the functions inside it
+void collectFunctions(const IFunction &function, std::vector<const IFunction *> &functions) {
+  functions.emplace_back(&function);
+  for (size_t i = 0; i < function.nFunctions(); ++i)
+    collectFunctions(*function.getFunction(i), functions);
+}
+} // namespace
 
 DECLARE_FUNCTION(MultiDomainFunction)
 
@@ -125,18 +135,25 @@ void MultiDomainFunction::function(const FunctionDomain &domain, FunctionValues
   }
 
   countValueOffsets(cd);
-  // evaluate member functions
-  values.zeroCalculated();
-  for (size_t iFun = 0; iFun < nFunctions(); ++iFun) {
+  // evaluate member functions, each on its own thread if they are thread safe.
+  // The values are added up in the same order whatever the number of threads.
+  const auto nFuns = nFunctions();
+  std::vector<std::vector<size_t>> domains(nFuns);
+  std::vector<std::vector<FunctionValues>> memberValues(nFuns);
+  forEachMember([&](const size_t iFun) {
     // find the domains member function must be applied to
-    std::vector<size_t> domains;
-    getDomainIndices(iFun, cd.getNParts(), domains);
-
-    for (auto const &dom : domains) {
+    getDomainIndices(iFun, cd.getNParts(), domains[iFun]);
+    memberValues[iFun].reserve(domains[iFun].size());
+    for (auto const &dom : domains[iFun]) {
       const FunctionDomain &d = cd.getDomain(dom);
-      FunctionValues tmp(d);
-      getFunction(iFun)->function(d, tmp);
-      values.addToCalculated(m_valueOffsets[dom], tmp);
+      getFunction(iFun)->function(d, memberValues[iFun].emplace_back(d));
+    }
+  });
+
+  values.zeroCalculated();
+  for (size_t iFun = 0; iFun < nFuns; ++iFun) {
+    for (size_t i = 0; i < domains[iFun].size(); ++i) {
+      values.addToCalculated(m_valueOffsets[domains[iFun][i]], memberValues[iFun][i]);
     }
   }
 }
@@ -165,8 +182,9 @@ void MultiDomainFunction::functionDeriv(const FunctionDomain &domain, Jacobian &
 
     jacobian.zero();
     countValueOffsets(cd);
-    // evaluate member functions derivatives
-    for (size_t iFun = 0; iFun < nFunctions(); ++iFun) {
+    // evaluate member functions derivatives. The members fill different
+    // columns of the jacobian, so they can do it on different threads.
+    forEachMember([&](const size_t iFun) {
       // find the domains member function must be applied to
       std::vector<size_t> domains;
       getDomainIndices(iFun, cd.getNParts(), domains);
@@ -176,8 +194,82 @@ void MultiDomainFunction::functionDeriv(const FunctionDomain &domain, Jacobian &
         PartialJacobian J(&jacobian, m_valueOffsets[dom], paramOffset(iFun));
         getFunction(iFun)->functionDeriv(d, J);
       }
+    });
+  }
+}
+
+/**
+ * Evaluate something for every member function, in parallel if the members
+ * are thread safe. A function that appears in more than one member, directly
+ * or inside a composite, is never used on two threads at once: the members
+ * holding it are evaluated one after another once the others are done.
+ * Exceptions are rethrown after all members are evaluated, the one of the
+ * first failing member first, so that failures are reported in the same way
+ * whatever the number of threads.
+ * @param evaluate :: evaluates the member with the given index
+ */
+void MultiDomainFunction::forEachMember(const std::function<void(size_t)> &evaluate) const {
+  const auto nFuns = static_cast<int>(nFunctions());
+  const auto &isShared = sharedMembers();
+
+  std::vector<std::exception_ptr> errors(nFuns);
+  const auto evaluateMember = [&](const int iFun) {
+    try {
+      evaluate(iFun);
+    } catch (...) {
+      errors[iFun] = std::current_exception();
     }
+  };
+  PARALLEL_FOR_IF(nFuns > 1 && threadSafe())
+  for (int iFun = 0; iFun < nFuns; ++iFun) {
+    if (!isShared[iFun])
+      evaluateMember(iFun);
+  }
+  for (int iFun = 0; iFun < nFuns; ++iFun) {
+    if (isShared[iFun])
+      evaluateMember(iFun);
+  }
+
+  for (const auto &error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+/**
+ * Find the members that share a function with another member. The result is
+ * cached and only worked out again when the functions inside the members
+ * change, as sharing depends on nothing else.
+ * @return :: a flag for each member, non-zero if the member is shared
+ */
+const std::vector<char> &MultiDomainFunction::sharedMembers() const {
+  const auto nFuns = nFunctions();
+  m_memberFunctionsScratch.clear();
+  std::vector<size_t> offsets(nFuns + 1, 0);
+  for (size_t iFun = 0; iFun < nFuns; ++iFun) {
+    collectFunctions(*getFunction(iFun), m_memberFunctionsScratch);
+    offsets[iFun + 1] = m_memberFunctionsScratch.size();
+  }
+  if (m_memberFunctionsScratch == m_memberFunctions && offsets == m_memberFunctionOffsets)
+    return m_isSharedMember;
+
+  std::vector<std::pair<const IFunction *, size_t>> owners;
+  owners.reserve(m_memberFunctionsScratch.size());
+  for (size_t iFun = 0; iFun < nFuns; ++iFun) {
+    for (auto i = offsets[iFun]; i < offsets[iFun + 1]; ++i)
+      owners.emplace_back(m_memberFunctionsScratch[i], iFun);
+  }
+  std::sort(owners.begin(), owners.end());
+  m_isSharedMember.assign(nFuns, 0);
+  for (size_t i = 1; i < owners.size(); ++i) {
+    const auto &[function, owner] = owners[i];
+    const auto &[previousFunction, previousOwner] = owners[i - 1];
+    if (function == previousFunction && owner != previousOwner)
+      m_isSharedMember[owner] = m_isSharedMember[previousOwner] = 1;
   }
+  m_memberFunctions.swap(m_memberFunctionsScratch);
+  m_memberFunctionOffsets = std::move(offsets);
+  return m_isSharedMember;
 }
 
 /**
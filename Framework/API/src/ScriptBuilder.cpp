@@ -102,20 +102,24 @@ void ScriptBuilder::writeHistoryToStream(std::ostringstream &os, std::vector<His
 
 void ScriptBuilder::createStringForAlg(std::ostringstream &os,
                                        std::shared_ptr<const Mantid::API::AlgorithmHistory> &algHistory) {
-  os << buildAlgorithmString(*algHistory);
-  if (m_timestampCommands) {
-    os << " # " << algHistory->executionDate().toISO8601String();
-  }
-
-  if (m_execCount) {
+  const auto algString = buildAlgorithmString(*algHistory);
+  // compact histories store consecutive identical executions as one record
+  for (size_t i = 0; i < algHistory->repeatCount(); ++i) {
+    os << algString;
     if (m_timestampCommands) {
-      os << " execCount: " << algHistory->execCount();
-    } else {
-      os << " # execCount: " << algHistory->execCount();
+      os << " # " << algHistory->executionDate().toISO8601String();
     }
-  }
 
-  os << "\n";
+    if (m_execCount) {
+      if (m_timestampCommands) {
+        os << " execCount: " << algHistory->execCount();
+      } else {
+        os << " # execCount: " << algHistory->execCount();
+      }
+    }
+
+    os << "\n";
+  }
 }
 
 /**
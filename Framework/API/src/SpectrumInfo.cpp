@@ -17,8 +17,11 @@
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <limits>
 #include <memory>
+#include <mutex>
 
 using namespace Mantid::Kernel;
 
@@ -26,10 +29,23 @@ namespace Mantid::API {
 /// static logger object
 Kernel::Logger g_log("ExperimentInfo");
 
+/// The values of each quantity for all spectra, and the geometry they were
+/// computed for.
+struct SpectrumInfo::CachedValues {
+  struct Entry {
+    std::vector<double> values;
+    size_t geometryVersion{0};
+    Kernel::cow_ptr<std::vector<SpectrumDefinition>> spectrumDefinitions{nullptr};
+  };
+  std::mutex mutex;
+  std::array<Entry, 5> entries;
+};
+
 SpectrumInfo::SpectrumInfo(const Beamline::SpectrumInfo &spectrumInfo, const ExperimentInfo &experimentInfo,
                            Geometry::DetectorInfo &detectorInfo)
     : m_experimentInfo(experimentInfo), m_detectorInfo(detectorInfo), m_spectrumInfo(spectrumInfo),
-      m_lastDetector(PARALLEL_GET_MAX_THREADS), m_lastIndex(PARALLEL_GET_MAX_THREADS, -1) {}
+      m_lastDetector(PARALLEL_GET_MAX_THREADS), m_lastIndex(PARALLEL_GET_MAX_THREADS, -1),
+      m_cachedValues(std::make_shared<CachedValues>()) {}
 
 // Defined as default in source for forward declaration with std::unique_ptr.
 SpectrumInfo::~SpectrumInfo() = default;
@@ -53,14 +69,14 @@ const Kernel::cow_ptr<std::vector<SpectrumDefinition>> &SpectrumInfo::sharedSpec
 
 /// Returns true if the detector(s) associated with the spectrum are monitors.
 bool SpectrumInfo::isMonitor(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   return std::all_of(spectrumDef.cbegin(), spectrumDef.cend(),
                      [this](const std::pair<size_t, size_t> &detIndex) { return m_detectorInfo.isMonitor(detIndex); });
 }
 
 /// Returns true if the detector(s) associated with the spectrum are masked.
 bool SpectrumInfo::isMasked(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   return std::all_of(spectrumDef.cbegin(), spectrumDef.cend(),
                      [this](const std::pair<size_t, size_t> &detIndex) { return m_detectorInfo.isMasked(detIndex); });
 }
@@ -71,7 +87,7 @@ bool SpectrumInfo::isMasked(const size_t index) const {
  * i.e., for a monitor in the beamline between source and sample L2 is negative.
  */
 double SpectrumInfo::l2(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto l2 = std::accumulate(
       spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
       [this](double x, const std::pair<size_t, size_t> &detIndex) { return x + m_detectorInfo.l2(detIndex); });
@@ -84,7 +100,7 @@ double SpectrumInfo::l2(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::twoTheta(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto twoTheta = std::accumulate(
       spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
       [this](double x, const std::pair<size_t, size_t> &detIndex) { return x + m_detectorInfo.twoTheta(detIndex); });
@@ -97,7 +113,7 @@ double SpectrumInfo::twoTheta(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::signedTwoTheta(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto signedTwoTheta = std::accumulate(spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
                                         [this](double x, const std::pair<size_t, size_t> &detIndex) {
                                           return x + m_detectorInfo.signedTwoTheta(detIndex);
@@ -111,7 +127,7 @@ double SpectrumInfo::signedTwoTheta(const size_t index) const {
  * Throws an exception if the spectrum is a monitor.
  */
 double SpectrumInfo::azimuthal(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto phi = std::accumulate(
       spectrumDef.cbegin(), spectrumDef.cend(), 0.0,
       [this](double x, const std::pair<size_t, size_t> &detIndex) { return x + m_detectorInfo.azimuthal(detIndex); });
@@ -135,7 +151,7 @@ std::pair<double, double> SpectrumInfo::geographicalAngles(const size_t index) c
 
 /// Returns the position of the spectrum with given index.
 Kernel::V3D SpectrumInfo::position(const size_t index) const {
-  const auto spectrumDef = checkAndGetSpectrumDefinition(index);
+  const auto &spectrumDef = checkAndGetSpectrumDefinition(index);
   auto newPos = std::accumulate(spectrumDef.cbegin(), spectrumDef.cend(), Kernel::V3D(),
                                 [this](const auto &x, const std::pair<size_t, size_t> &detIndex) {
                                   return x + m_detectorInfo.position(detIndex);
@@ -305,6 +321,42 @@ bool SpectrumInfo::hasUniqueDetector(const size_t index) const {
   return spectrumDefinition(index).size() == 1;
 }
 
+/** Returns L2 of all spectra, see l2(). Spectra without detectors are NaN.
+ *
+ * The values are computed in parallel on the first call and kept until the
+ * detector, source or sample positions or the grouping of detectors into
+ * spectra change. The reference is valid until then, so get it once before
+ * looping over spectra rather than on each iteration.
+ */
+const std::vector<double> &SpectrumInfo::l2s() const { return cachedValues(CachedQuantity::L2); }
+
+/** Returns 2 theta of all spectra, see twoTheta(). Spectra without detectors
+ * and monitors are NaN. The values are kept as described in l2s().
+ */
+const std::vector<double> &SpectrumInfo::twoThetas() const { return cachedValues(CachedQuantity::TwoTheta); }
+
+/** Returns the signed 2 theta of all spectra, see signedTwoTheta(). Spectra
+ * without detectors and monitors are NaN. The values are kept as described in
+ * l2s().
+ */
+const std::vector<double> &SpectrumInfo::signedTwoThetas() const {
+  return cachedValues(CachedQuantity::SignedTwoTheta);
+}
+
+/** Returns the azimuthal angle of all spectra, see azimuthal(). Spectra
+ * without detectors and monitors are NaN. The values are kept as described in
+ * l2s().
+ */
+const std::vector<double> &SpectrumInfo::azimuthals() const { return cachedValues(CachedQuantity::Azimuthal); }
+
+/** Returns the uncalibrated DIFC of all spectra, see difcUncalibrated().
+ * Spectra without detectors and monitors are NaN. The values are kept as
+ * described in l2s().
+ */
+const std::vector<double> &SpectrumInfo::difcsUncalibrated() const {
+  return cachedValues(CachedQuantity::DifcUncalibrated);
+}
+
 /** Set the mask flag of the spectrum with given index. Not thread safe.
  *
  * Currently this simply sets the mask flags for the underlying detectors. */
@@ -365,6 +417,63 @@ const SpectrumDefinition &SpectrumInfo::checkAndGetSpectrumDefinition(const size
   return spectrumDefinition(index);
 }
 
+/** Returns the values of a quantity for all spectra, computing them if the
+ * geometry or the spectrum definitions changed since they were last computed.
+ * @param quantity :: the quantity to return
+ * @return a reference to the values, one per spectrum
+ */
+const std::vector<double> &SpectrumInfo::cachedValues(const CachedQuantity quantity) const {
+  const auto &spectrumDefinitions = sharedSpectrumDefinitions();
+  const auto geometryVersion = m_detectorInfo.geometryVersion();
+  auto &entry = m_cachedValues->entries[static_cast<size_t>(quantity)];
+  std::lock_guard<std::mutex> lock(m_cachedValues->mutex);
+  if (entry.geometryVersion == geometryVersion && entry.spectrumDefinitions == spectrumDefinitions)
+    return entry.values;
+
+  std::vector<double> values(size());
+  const auto numberOfSpectra = static_cast<int64_t>(values.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numberOfSpectra; ++i) {
+    values[i] = computeValue(quantity, static_cast<size_t>(i));
+  }
+  entry.values = std::move(values);
+  entry.geometryVersion = geometryVersion;
+  entry.spectrumDefinitions = spectrumDefinitions;
+  return entry.values;
+}
+
+/** Computes a quantity for one spectrum, returning NaN where it is undefined
+ * instead of throwing.
+ * @param quantity :: the quantity to compute
+ * @param index :: the spectrum index
+ * @return the value for the spectrum
+ */
+double SpectrumInfo::computeValue(const CachedQuantity quantity, const size_t index) const {
+  constexpr double undefined = std::numeric_limits<double>::quiet_NaN();
+  if (m_spectrumInfo.spectrumDefinition(index).size() == 0)
+    return undefined;
+  if (quantity == CachedQuantity::L2)
+    return l2(index);
+  if (isMonitor(index))
+    return undefined;
+  try {
+    switch (quantity) {
+    case CachedQuantity::TwoTheta:
+      return twoTheta(index);
+    case CachedQuantity::SignedTwoTheta:
+      return signedTwoTheta(index);
+    case CachedQuantity::Azimuthal:
+      return azimuthal(index);
+    case CachedQuantity::DifcUncalibrated:
+      return difcUncalibrated(index);
+    default:
+      return undefined;
+    }
+  } catch (const std::exception &) {
+    return undefined;
+  }
+}
+
 // Begin method for iterator
 SpectrumInfoIt SpectrumInfo::begin() { return SpectrumInfoIt(*this, 0); }
 
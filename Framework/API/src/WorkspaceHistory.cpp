@@ -288,6 +288,12 @@ void WorkspaceHistory::loadNestedHistory(Nexus::File *file, const AlgorithmHisto
 
     try {
       AlgorithmHistory_sptr history = parseAlgorithmHistory(rawData);
+      // only written for records of repeated executions in compact histories
+      if (file->hasData("repeat_count")) {
+        uint64_t repeatCount(1);
+        file->readData("repeat_count", repeatCount);
+        history->setRepeatCount(static_cast<std::size_t>(repeatCount));
+      }
       loadNestedHistory(file, history);
       if (parent) {
         parent->addChildHistory(history);
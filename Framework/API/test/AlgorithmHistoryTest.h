@@ -179,6 +179,45 @@ public:
     TS_ASSERT_EQUALS(alg->getPropertyValue("arg1_param"), "child1");
   }
 
+  void test_Compact_Child_History_Collapses_Repeats() {
+    AlgorithmHistory algHist = createTestHistory();
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child1")), true);
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child1")), true);
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child1")), true);
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child2")), true);
+
+    const auto &children = algHist.getChildHistories();
+    TS_ASSERT_EQUALS(children.size(), 2);
+    TS_ASSERT_EQUALS(children[0]->repeatCount(), 3);
+    TS_ASSERT_EQUALS(children[0]->getPropertyValue("arg1_param"), "child1");
+    TS_ASSERT_EQUALS(children[1]->repeatCount(), 1);
+    TS_ASSERT_EQUALS(children[1]->getPropertyValue("arg1_param"), "child2");
+  }
+
+  void test_Compact_Child_History_Shares_Unchanged_Properties() {
+    AlgorithmHistory algHist = createTestHistory();
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child1")), true);
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child2")), true);
+
+    const auto &children = algHist.getChildHistories();
+    TS_ASSERT_EQUALS(children.size(), 2);
+    const auto &first = children[0]->getProperties();
+    const auto &second = children[1]->getProperties();
+    TS_ASSERT_DIFFERS(first[0], second[0]);
+    TS_ASSERT_EQUALS(first[1], second[1]);
+  }
+
+  void test_Child_History_Keeps_Repeats_By_Default() {
+    AlgorithmHistory algHist = createTestHistory();
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child1")));
+    algHist.addChildHistory(std::make_shared<AlgorithmHistory>(createFromTestAlg("child1")));
+
+    const auto &children = algHist.getChildHistories();
+    TS_ASSERT_EQUALS(children.size(), 2);
+    TS_ASSERT_EQUALS(children[0]->repeatCount(), 1);
+    TS_ASSERT_DIFFERS(children[0]->getProperties()[1], children[1]->getProperties()[1]);
+  }
+
 private:
   AlgorithmHistory createTestHistory() {
     m_correctOutput = "Algorithm: testalg ";
@@ -0,0 +1,240 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Algorithm.h"
+#include "MantidAPI/AlgorithmHistory.h"
+#include "MantidAPI/AlgorithmResultCache.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/Sample.h"
+#include "MantidAPI/WorkspaceHistory.h"
+#include "MantidAPI/WorkspaceProperty.h"
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidFrameworkTestHelpers/FakeObjects.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Material.h"
+#include "MantidKernel/NeutronAtom.h"
+
+using namespace Mantid::API;
+using namespace Mantid::Kernel;
+
+namespace {
+/// Scales its input and counts how often exec() is called
+class PureScaleAlgorithm : public Algorithm {
+public:
+  const std::string name() const override { return "PureScaleAlgorithm"; }
+  int version() const override { return 1; }
+  const std::string summary() const override { return "Test summary"; }
+  bool isPure() const override { return m_pure; }
+  bool dependsOnInputCounts() const override { return m_dependsOnCounts; }
+
+  void init() override {
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>("InputWorkspace", "", Direction::Input));
+    declareProperty("Factor", 1.0);
+    declareProperty(std::make_unique<WorkspaceProperty<MatrixWorkspace>>("OutputWorkspace", "", Direction::Output));
+    declareProperty("Sum", 0.0, Direction::Output);
+    declareProperty("NumberDensity", 0.0, Direction::Output);
+  }
+  void exec() override {
+    ++execCount;
+    MatrixWorkspace_const_sptr input = getProperty("InputWorkspace");
+    const double factor = getProperty("Factor");
+    MatrixWorkspace_sptr output = input->clone();
+    double sum = 0.;
+    for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+      for (auto &y : output->dataY(i)) {
+        y *= factor;
+        sum += y;
+      }
+    }
+    setProperty("OutputWorkspace", output);
+    setProperty("Sum", sum);
+    setProperty("NumberDensity", input->sample().getMaterial().numberDensity());
+  }
+
+  bool m_pure{true};
+  bool m_dependsOnCounts{true};
+  static int execCount;
+};
+int PureScaleAlgorithm::execCount = 0;
+} // namespace
+
+class AlgorithmResultCacheTest : public CxxTest::TestSuite {
+public:
+  static AlgorithmResultCacheTest *createSuite() { return new AlgorithmResultCacheTest(); }
+  static void destroySuite(AlgorithmResultCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_maxMemory = ConfigService::Instance().getString("algorithms.memoize.maxmemory");
+    ConfigService::Instance().setString("algorithms.memoize.maxmemory", "100");
+    AlgorithmResultCache::Instance().clear();
+    PureScaleAlgorithm::execCount = 0;
+  }
+
+  void tearDown() override {
+    ConfigService::Instance().setString("algorithms.memoize.maxmemory", m_maxMemory);
+    AlgorithmResultCache::Instance().clear();
+  }
+
+  void test_identical_execution_reuses_outputs() {
+    auto input = createWorkspace();
+    MatrixWorkspace_sptr first = runScale(input, 2.);
+    MatrixWorkspace_sptr second = runScale(input, 2.);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 1);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 1);
+    TS_ASSERT_DIFFERS(first, second);
+    TS_ASSERT_EQUALS(second->y(1)[2], 2.);
+  }
+
+  void test_non_workspace_outputs_are_restored() {
+    auto input = createWorkspace();
+    runScale(input, 3.);
+    PureScaleAlgorithm alg;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setProperty("Factor", 3.);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    alg.execute();
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 1);
+    const double sum = alg.getProperty("Sum");
+    TS_ASSERT_EQUALS(sum, 3. * 3. * 4.);
+  }
+
+  void test_separately_created_identical_inputs_reuse_outputs() {
+    auto input = createWorkspace();
+    runScale(input, 2.);
+    auto sameInput = createWorkspace();
+    sameInput->history().addHistory(std::make_shared<AlgorithmHistory>("LoadSomething", 1, "an-id"));
+    runScale(sameInput, 2.);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 1);
+  }
+
+  void test_counts_and_logs_are_only_fingerprinted_if_depended_on() {
+    auto ws = createWorkspace();
+    const auto &cache = AlgorithmResultCache::Instance();
+    const auto withCounts = cache.fingerprint(*ws);
+    const auto withoutCounts = cache.fingerprint(*ws, false);
+
+    ws->mutableY(0)[0] = 5.;
+    ws->mutableRun().addProperty("temperature", 300.);
+    TS_ASSERT_DIFFERS(cache.fingerprint(*ws), withCounts);
+    TS_ASSERT_EQUALS(cache.fingerprint(*ws, false), withoutCounts);
+
+    runScale(ws, 2., true, false);
+    ws->mutableY(0)[0] = 7.;
+    runScale(ws, 2., true, false);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 1);
+  }
+
+  void test_changed_property_executes_again() {
+    auto input = createWorkspace();
+    runScale(input, 2.);
+    runScale(input, 4.);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 2);
+  }
+
+  void test_changed_input_data_executes_again() {
+    auto input = createWorkspace();
+    runScale(input, 2.);
+    input->mutableY(0)[0] = 5.;
+    MatrixWorkspace_sptr output = runScale(input, 2.);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 2);
+    TS_ASSERT_EQUALS(output->y(0)[0], 10.);
+  }
+
+  void test_changed_sample_executes_again() {
+    auto input = createWorkspace();
+    const auto numberDensity = [&input]() -> double {
+      PureScaleAlgorithm alg;
+      alg.initialize();
+      alg.setChild(true);
+      alg.setProperty("InputWorkspace", input);
+      alg.setPropertyValue("OutputWorkspace", "out");
+      alg.execute();
+      return alg.getProperty("NumberDensity");
+    };
+    setSample(*input, 1.0, 0.07);
+    const double first = numberDensity();
+    setSample(*input, 1.0, 0.05);
+    const double second = numberDensity();
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 2);
+    TS_ASSERT_EQUALS(first, 0.07);
+    TS_ASSERT_EQUALS(second, 0.05);
+  }
+
+  void test_fingerprint_follows_sample_shape_and_instrument_geometry() {
+    auto ws = createWorkspace();
+    ws->setInstrument(ComponentCreationHelper::createTestInstrumentCylindrical(1));
+    setSample(*ws, 1.0, 0.07);
+    const auto &cache = AlgorithmResultCache::Instance();
+    const auto original = cache.fingerprint(*ws);
+
+    setSample(*ws, 2.0, 0.07);
+    const auto resized = cache.fingerprint(*ws);
+    TS_ASSERT_DIFFERS(resized, original);
+
+    ws->mutableComponentInfo().setPosition(0, Mantid::Kernel::V3D(0., 0.1, 5.));
+    TS_ASSERT_DIFFERS(cache.fingerprint(*ws), resized);
+  }
+
+  void test_algorithms_that_are_not_pure_always_execute() {
+    auto input = createWorkspace();
+    runScale(input, 2., false);
+    runScale(input, 2., false);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 2);
+    TS_ASSERT_EQUALS(AlgorithmResultCache::Instance().size(), 0);
+  }
+
+  void test_disabled_by_default() {
+    ConfigService::Instance().setString("algorithms.memoize.maxmemory", "0");
+    auto input = createWorkspace();
+    runScale(input, 2.);
+    runScale(input, 2.);
+    TS_ASSERT_EQUALS(PureScaleAlgorithm::execCount, 2);
+  }
+
+  void test_fingerprint_is_only_created_for_matrix_workspaces() {
+    TS_ASSERT(AlgorithmResultCache::Instance().fingerprint(*createWorkspace()));
+    TS_ASSERT(!AlgorithmResultCache::Instance().fingerprint(TableWorkspaceTester()));
+  }
+
+private:
+  MatrixWorkspace_sptr createWorkspace() {
+    auto ws = std::make_shared<WorkspaceTester>();
+    ws->initialize(3, 4, 4);
+    for (size_t i = 0; i < 3; ++i)
+      ws->mutableY(i) = 1.;
+    return ws;
+  }
+
+  void setSample(MatrixWorkspace &ws, const double radius, const double numberDensity) {
+    auto shape = ComponentCreationHelper::createSphere(radius);
+    shape->setMaterial(Material("Vanadium", Mantid::PhysicalConstants::getNeutronAtom(23, 0), numberDensity));
+    ws.mutableSample().setShape(shape);
+  }
+
+  MatrixWorkspace_sptr runScale(const MatrixWorkspace_sptr &input, const double factor, const bool pure = true,
+                                const bool dependsOnCounts = true) {
+    PureScaleAlgorithm alg;
+    alg.m_pure = pure;
+    alg.m_dependsOnCounts = dependsOnCounts;
+    alg.initialize();
+    alg.setChild(true);
+    alg.setProperty("InputWorkspace", input);
+    alg.setProperty("Factor", factor);
+    alg.setPropertyValue("OutputWorkspace", "out");
+    alg.execute();
+    return alg.getProperty("OutputWorkspace");
+  }
+
+  std::string m_maxMemory;
+};
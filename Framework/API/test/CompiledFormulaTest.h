@@ -0,0 +1,108 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/CompiledFormula.h"
+
+#include <cmath>
+
+using Mantid::API::CompiledFormula;
+
+class CompiledFormulaTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompiledFormulaTest *createSuite() { return new CompiledFormulaTest(); }
+  static void destroySuite(CompiledFormulaTest *suite) { delete suite; }
+
+  void test_values_over_several_blocks() {
+    const CompiledFormula formula("h * sin(a*x - c) + 2.5e-1*x^2 / (1 + _pi)", "x", {"h", "a", "c"});
+    TS_ASSERT_EQUALS(formula.numberOfScalars(), 3);
+    const std::vector<double> scalars{2.2, 2.0, 1.2};
+    const auto x = makeX(1000);
+    std::vector<double> y(x.size());
+    formula.evaluate(x.data(), x.size(), scalars.data(), y.data());
+    for (size_t i = 0; i < x.size(); ++i)
+      TS_ASSERT_DELTA(y[i], 2.2 * std::sin(2.0 * x[i] - 1.2) + 0.25 * x[i] * x[i] / (1.0 + M_PI), 1e-12);
+  }
+
+  void test_derivatives_match_finite_differences() {
+    checkDerivatives("a*exp(-b*x^2) + c/(1 + (x - a)^2) + sqrt(abs(x) + a) - atan(b*x)*erf(c*x)", {1.3, 0.7, 0.4});
+    checkDerivatives("x^a * ln(b + x^2) + cosh(c*x)/tanh(a + x^2) + a^b", {0.8, 1.5, 0.3});
+  }
+
+  void test_power_derivatives_are_finite_at_zero_base() {
+    const CompiledFormula formula("x^a + b^c * x", "x", {"a", "b", "c"});
+    const std::vector<double> scalars{1.5, 0.0, 2.0};
+    const std::vector<double> x{0.0, 0.5};
+    std::vector<std::vector<double>> derivatives(3, std::vector<double>(x.size()));
+    formula.evaluateDerivatives(x.data(), x.size(), scalars.data(),
+                                {derivatives[0].data(), derivatives[1].data(), derivatives[2].data()});
+    TS_ASSERT_EQUALS(derivatives[0][0], 0.0);
+    TS_ASSERT_DELTA(derivatives[0][1], std::pow(0.5, 1.5) * std::log(0.5), 1e-12);
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_EQUALS(derivatives[1][i], 0.0);
+      TS_ASSERT_EQUALS(derivatives[2][i], 0.0);
+    }
+  }
+
+  void test_formulas_independent_of_x() {
+    const CompiledFormula formula("-a*-b + 3", "x", {"a", "b", "unused"});
+    const std::vector<double> scalars{2.0, 5.0, 1.0};
+    const auto x = makeX(300);
+    std::vector<double> y(x.size());
+    formula.evaluate(x.data(), x.size(), scalars.data(), y.data());
+    std::vector<std::vector<double>> derivatives(3, std::vector<double>(x.size(), -1.0));
+    formula.evaluateDerivatives(x.data(), x.size(), scalars.data(),
+                                {derivatives[0].data(), derivatives[1].data(), derivatives[2].data()});
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_EQUALS(y[i], 13.0);
+      TS_ASSERT_EQUALS(derivatives[0][i], 5.0);
+      TS_ASSERT_EQUALS(derivatives[1][i], 2.0);
+      TS_ASSERT_EQUALS(derivatives[2][i], 0.0);
+    }
+  }
+
+  void test_unsupported_formulas_are_rejected() {
+    const std::vector<std::string> scalars{"a"};
+    for (const auto *text : {"x > a", "a ? x : 1", "min(x, a)", "log(x)", "y*x", "-x^2", "a*+x^a", "x^2^3", "2x",
+                             "(a*x", "sin x", "0x12", "1.2.3"})
+      TS_ASSERT_THROWS(CompiledFormula(text, "x", scalars), const std::invalid_argument &);
+    TS_ASSERT_THROWS_NOTHING(CompiledFormula("-(x^2) + (-x)^2 + (x^2)^a + 1.5e+3 + .5", "x", scalars));
+  }
+
+private:
+  std::vector<double> makeX(const size_t n) {
+    std::vector<double> x(n);
+    for (size_t i = 0; i < n; ++i)
+      x[i] = 0.1 + 3.0 * static_cast<double>(i) / static_cast<double>(n);
+    return x;
+  }
+
+  void checkDerivatives(const std::string &text, std::vector<double> scalars) {
+    const CompiledFormula formula(text, "x", {"a", "b", "c"});
+    const auto x = makeX(400);
+    std::vector<std::vector<double>> derivatives(3, std::vector<double>(x.size()));
+    formula.evaluateDerivatives(x.data(), x.size(), scalars.data(),
+                                {derivatives[0].data(), derivatives[1].data(), derivatives[2].data()});
+    std::vector<double> plus(x.size()), minus(x.size());
+    for (size_t j = 0; j < scalars.size(); ++j) {
+      const double step = 1e-6;
+      scalars[j] += step;
+      formula.evaluate(x.data(), x.size(), scalars.data(), plus.data());
+      scalars[j] -= 2.0 * step;
+      formula.evaluate(x.data(), x.size(), scalars.data(), minus.data());
+      scalars[j] += step;
+      for (size_t i = 0; i < x.size(); ++i) {
+        const double expected = (plus[i] - minus[i]) / (2.0 * step);
+        TS_ASSERT_DELTA(derivatives[j][i], expected, 1e-6 * std::max(1.0, std::fabs(expected)));
+      }
+    }
+  }
+};
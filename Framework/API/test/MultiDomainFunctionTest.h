@@ -15,8 +15,11 @@
 #include "MantidAPI/ParamFunction.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cxxtest/TestSuite.h>
 #include <memory>
+#include <thread>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -28,6 +31,7 @@ public:
     this->declareParameter("B", 0);
   }
   std::string name() const override { return "MultiDomainFunctionTest_Function"; }
+  bool threadSafe() const override { return true; }
 
 protected:
   void function1D(double *out, const double *xValues, const size_t nData) const override {
@@ -52,6 +56,46 @@ DECLARE_FUNCTION(MultiDomainFunctionTest_Function)
 
 namespace {
 
+class ThrowingFunction : public IFunction1D, public ParamFunction {
+public:
+  std::string name() const override { return "ThrowingFunction"; }
+  void function1D(double *, const double *, const size_t) const override {
+    throw std::runtime_error("ThrowingFunction");
+  }
+};
+
+/// Records whether the same instance is ever evaluated on two threads at once
+class ConcurrencyCheckingFunction : public IFunction1D, public ParamFunction {
+public:
+  ConcurrencyCheckingFunction() { declareParameter("A", 1.0); }
+  std::string name() const override { return "ConcurrencyCheckingFunction"; }
+  bool threadSafe() const override { return true; }
+  void function1D(double *out, const double *, const size_t nData) const override {
+    if (++m_active > 1)
+      m_overlapped = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    std::fill_n(out, nData, getParameter(0));
+    --m_active;
+  }
+  bool overlapped() const { return m_overlapped; }
+
+private:
+  mutable std::atomic<int> m_active{0};
+  mutable std::atomic<bool> m_overlapped{false};
+};
+
+class DenseJacobian : public Jacobian {
+public:
+  DenseJacobian(size_t ny, size_t np) : m_np(np), m_data(ny * np, -1.0) {}
+  void set(size_t iY, size_t iP, double value) override { m_data[iY * m_np + iP] = value; }
+  double get(size_t iY, size_t iP) override { return m_data[iY * m_np + iP]; }
+  void zero() override { std::fill(m_data.begin(), m_data.end(), 0.0); }
+
+private:
+  size_t m_np;
+  std::vector<double> m_data;
+};
+
 class JacobianToTestNumDeriv : public Jacobian {
   size_t n[3];
   size_t np;
@@ -402,6 +446,117 @@ public:
     }
   }
 
+  void test_many_members_and_domains() {
+    MultiDomainFunction many;
+    JointDomain manyDomains;
+    const size_t nMembers = 40;
+    for (size_t i = 0; i < nMembers; ++i) {
+      auto fun = std::make_shared<MultiDomainFunctionTest_Function>();
+      fun->setParameter("A", static_cast<double>(i));
+      fun->setParameter("B", 0.5);
+      many.addFunction(fun);
+      many.setDomainIndex(i, i);
+      manyDomains.addDomain(std::make_shared<FunctionDomain1DVector>(0, 1, 10 + i));
+    }
+    // the last member is also applied to the first domain
+    many.setDomainIndices(nMembers - 1, {nMembers - 1, 0});
+    many.setAttributeValue("NumDeriv", false);
+
+    FunctionValues values(manyDomains);
+    many.function(manyDomains, values);
+    DenseJacobian jacobian(manyDomains.size(), many.nParams());
+    many.functionDeriv(manyDomains, jacobian);
+
+    size_t offset = 0;
+    for (size_t i = 0; i < nMembers; ++i) {
+      const auto &d = static_cast<const FunctionDomain1D &>(manyDomains.getDomain(i));
+      for (size_t j = 0; j < d.size(); ++j) {
+        const double expected = static_cast<double>(i == 0 ? nMembers - 1 : i) + (i == 0 ? 1.0 : 0.5) * d[j];
+        TS_ASSERT_DELTA(values.getCalculated(offset + j), expected, 1e-12);
+        for (size_t iP = 0; iP < many.nParams(); ++iP) {
+          const size_t member = iP / 2;
+          const bool applies = member == i || (i == 0 && member == nMembers - 1);
+          TS_ASSERT_EQUALS(jacobian.get(offset + j, iP), applies ? (iP % 2 == 0 ? d[j] : 1.0) : 0.0);
+        }
+      }
+      offset += d.size();
+    }
+  }
+
+  void test_threadSafe_is_opt_in() {
+    TS_ASSERT(!ThrowingFunction().threadSafe());
+    TS_ASSERT(MultiDomainFunctionTest_Function().threadSafe());
+    MultiDomainFunction mixed;
+    mixed.addFunction(std::make_shared<MultiDomainFunctionTest_Function>());
+    TS_ASSERT(mixed.threadSafe());
+    mixed.addFunction(std::make_shared<ThrowingFunction>());
+    TS_ASSERT(!mixed.threadSafe());
+  }
+
+  void test_shared_member_is_not_used_on_two_threads() {
+    MultiDomainFunction shared;
+    JointDomain domains;
+    auto fun = std::make_shared<ConcurrencyCheckingFunction>();
+    const size_t nMembers = 8;
+    for (size_t i = 0; i < nMembers; ++i) {
+      if (i % 2 == 0) {
+        shared.addFunction(fun);
+      } else {
+        // the shared function is also hidden inside composites
+        auto composite = std::make_shared<CompositeFunction>();
+        composite->addFunction(fun);
+        shared.addFunction(composite);
+      }
+      shared.setDomainIndex(i, i);
+      domains.addDomain(std::make_shared<FunctionDomain1DVector>(0, 1, 5));
+    }
+    FunctionValues values(domains);
+    shared.function(domains, values);
+    TS_ASSERT(!fun->overlapped());
+    for (size_t i = 0; i < values.size(); ++i)
+      TS_ASSERT_EQUALS(values.getCalculated(i), 1.0);
+  }
+
+  void test_members_shared_after_an_evaluation_are_not_used_on_two_threads() {
+    MultiDomainFunction multi;
+    JointDomain domains;
+    std::vector<std::shared_ptr<CompositeFunction>> composites;
+    const size_t nMembers = 8;
+    for (size_t i = 0; i < nMembers; ++i) {
+      auto composite = std::make_shared<CompositeFunction>();
+      composite->addFunction(std::make_shared<ConcurrencyCheckingFunction>());
+      multi.addFunction(composite);
+      multi.setDomainIndex(i, i);
+      composites.emplace_back(composite);
+      domains.addDomain(std::make_shared<FunctionDomain1DVector>(0, 1, 5));
+    }
+    FunctionValues values(domains);
+    multi.function(domains, values);
+
+    // share one function between the members by changing them from the inside
+    auto fun = std::make_shared<ConcurrencyCheckingFunction>();
+    for (const auto &composite : composites)
+      composite->replaceFunction(0, fun);
+    multi.function(domains, values);
+    TS_ASSERT(!fun->overlapped());
+    for (size_t i = 0; i < values.size(); ++i)
+      TS_ASSERT_EQUALS(values.getCalculated(i), 1.0);
+  }
+
+  void test_error_in_member_is_rethrown() {
+    MultiDomainFunction withError;
+    JointDomain twoDomains;
+    withError.addFunction(std::make_shared<MultiDomainFunctionTest_Function>());
+    withError.addFunction(std::make_shared<ThrowingFunction>());
+    withError.setDomainIndex(0, 0);
+    withError.setDomainIndex(1, 1);
+    twoDomains.addDomain(std::make_shared<FunctionDomain1DVector>(0, 1, 10));
+    twoDomains.addDomain(std::make_shared<FunctionDomain1DVector>(0, 1, 10));
+    FunctionValues values(twoDomains);
+    TS_ASSERT_THROWS_EQUALS(withError.function(twoDomains, values), const std::runtime_error &e, e.what(),
+                            std::string("ThrowingFunction"));
+  }
+
   void test_clone_preserves_domains() {
     const auto copy = multi.clone();
     TS_ASSERT_EQUALS(copy->getNumberDomains(), multi.getNumberDomains());
@@ -12,6 +12,7 @@
 #include "MantidAPI/SpectrumInfoIterator.h"
 #include "MantidBeamline/SpectrumInfo.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/MultiThreaded.h"
@@ -19,6 +20,8 @@
 #include "MantidFrameworkTestHelpers/FakeObjects.h"
 #include "MantidFrameworkTestHelpers/InstrumentCreationHelper.h"
 
+#include <cmath>
+
 using namespace Mantid;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
@@ -264,6 +267,64 @@ public:
     detectorInfo.setPosition(1, oldPos);
   }
 
+  void test_bulk_values_match_values_of_each_spectrum() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &l2s = spectrumInfo.l2s();
+    const auto &twoThetas = spectrumInfo.twoThetas();
+    const auto &signedTwoThetas = spectrumInfo.signedTwoThetas();
+    const auto &azimuthals = spectrumInfo.azimuthals();
+    const auto &difcs = spectrumInfo.difcsUncalibrated();
+    TS_ASSERT_EQUALS(l2s.size(), spectrumInfo.size());
+    for (size_t i = 0; i < spectrumInfo.size(); ++i) {
+      TS_ASSERT_EQUALS(l2s[i], spectrumInfo.l2(i));
+      if (spectrumInfo.isMonitor(i)) {
+        TS_ASSERT(std::isnan(twoThetas[i]));
+        TS_ASSERT(std::isnan(signedTwoThetas[i]));
+        TS_ASSERT(std::isnan(azimuthals[i]));
+        TS_ASSERT(std::isnan(difcs[i]));
+      } else {
+        TS_ASSERT_EQUALS(twoThetas[i], spectrumInfo.twoTheta(i));
+        TS_ASSERT_EQUALS(signedTwoThetas[i], spectrumInfo.signedTwoTheta(i));
+        TS_ASSERT_EQUALS(azimuthals[i], spectrumInfo.azimuthal(i));
+        TS_ASSERT_EQUALS(difcs[i], spectrumInfo.difcUncalibrated(i));
+      }
+    }
+    // Values are kept while nothing changes
+    TS_ASSERT_EQUALS(&spectrumInfo.l2s(), &l2s);
+    TS_ASSERT_EQUALS(spectrumInfo.twoThetas().data(), twoThetas.data());
+  }
+
+  void test_bulk_values_track_position_changes() {
+    auto &detectorInfo = m_workspace.mutableDetectorInfo();
+    auto &componentInfo = m_workspace.mutableComponentInfo();
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto oldL2 = spectrumInfo.l2s()[1];
+    const auto oldPos = detectorInfo.position(1);
+    detectorInfo.setPosition(1, V3D(0.0, 0.0, 6.0));
+    TS_ASSERT_EQUALS(spectrumInfo.l2s()[1], 6.0);
+    detectorInfo.setPosition(1, oldPos);
+    TS_ASSERT_EQUALS(spectrumInfo.l2s()[1], oldL2);
+
+    const auto oldSamplePos = componentInfo.samplePosition();
+    componentInfo.setPosition(componentInfo.sample(), V3D(0.0, 0.0, 1.0));
+    TS_ASSERT_DELTA(spectrumInfo.l2s()[1], oldL2 - 1.0, 1e-12);
+    TS_ASSERT_EQUALS(spectrumInfo.difcsUncalibrated()[0], spectrumInfo.difcUncalibrated(0));
+    componentInfo.setPosition(componentInfo.sample(), oldSamplePos);
+    TS_ASSERT_EQUALS(spectrumInfo.l2s()[1], oldL2);
+  }
+
+  void test_bulk_values_track_grouping_changes() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0, 1e-6);
+    m_workspace.getSpectrum(1).setDetectorIDs({1, 3});
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0199973, 1e-6);
+    m_workspace.getSpectrum(1).clearDetectorIDs();
+    TS_ASSERT(std::isnan(spectrumInfo.l2s()[1]));
+    TS_ASSERT(std::isnan(spectrumInfo.twoThetas()[1]));
+    m_workspace.getSpectrum(1).setDetectorID(2);
+    TS_ASSERT_DELTA(spectrumInfo.twoThetas()[1], 0.0, 1e-6);
+  }
+
   void test_hasDetectors() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasDetectors(0));
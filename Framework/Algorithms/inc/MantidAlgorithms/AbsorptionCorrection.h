@@ -19,7 +19,8 @@ namespace Mantid {
 
 namespace API {
 class Sample;
-}
+class SpectrumInfo;
+} // namespace API
 namespace Geometry {
 class IDetector;
 class IObject;
@@ -76,6 +77,10 @@ public:
            "and single scattering in a generic sample shape. The sample shape "
            "can be defined by the CreateSampleShape algorithm.";
   }
+  /// The correction depends only on the input workspace and the properties
+  bool isPure() const override { return true; }
+  /// The correction depends on the binning and geometry, not on the counts
+  bool dependsOnInputCounts() const override { return false; }
 
 protected:
   /** A virtual function in which additional properties of an algorithm should
@@ -115,7 +120,9 @@ private:
 
   void retrieveBaseProperties();
   void constructSample(API::Sample &sample);
+  Kernel::V3D detectorPosition(const Geometry::IDetector &detector) const;
   void calculateDistances(const Geometry::IDetector &detector, std::vector<double> &L2s) const;
+  std::string pathLengthCacheKey(const API::SpectrumInfo &spectrumInfo) const;
   inline double doIntegration(const double linearCoefAbs, const std::vector<double> &L2s, const size_t startIndex,
                               const size_t endIndex) const;
   inline double doIntegration(const double linearCoefAbsL1, const double linearCoefAbsL2,
@@ -65,6 +65,8 @@ public:
   }
   /// Algorithm's category for identification
   const std::string category() const override { return "SANS;CorrectionFunctions\\TransmissionCorrections"; }
+  /// The transmission depends only on the input workspaces and the properties
+  bool isPure() const override { return true; }
 
 private:
   /// stores an estimate of the progress so far as a proportion (starts at zero
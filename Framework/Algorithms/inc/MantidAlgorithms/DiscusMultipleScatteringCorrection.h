@@ -20,6 +20,7 @@
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 #include <boost/container/small_vector.hpp>
 #include <shared_mutex>
+#include <unordered_map>
 
 namespace Mantid {
 namespace API {
@@ -89,6 +90,8 @@ class MANTID_ALGORITHMS_DLL DiscusMultipleScatteringCorrection : public API::Alg
 public:
   // use small_vector to avoid performance hit from heap allocation of std::vector. Use size 5 in line with Track.h
   using ComponentWorkspaceMappings = boost::container::small_vector<ComponentWorkspaceMapping, 5>;
+  // inverse cumulative Q distributions that have already been calculated, keyed on the incident wavevector
+  using CumulativeProbCache = std::unordered_map<double, ComponentWorkspaceMappings>;
   /// Algorithm's name
   const std::string name() const override { return "DiscusMultipleScatteringCorrection"; }
   /// Algorithm's version
@@ -135,13 +138,14 @@ private:
   simulatePaths(const int nEvents, const int nScatters, Kernel::PseudoRandomNumberGenerator &rng,
                 const ComponentWorkspaceMappings &componentWorkspaces, const double kinc,
                 const std::vector<double> &wValues, bool specialSingleScatterCalc,
-                const Mantid::Geometry::DetectorInfo &detectorInfo, const size_t &histogramIndex);
+                const Mantid::Geometry::DetectorInfo &detectorInfo, const size_t &histogramIndex,
+                CumulativeProbCache &cumulativeProbs);
   std::tuple<bool, std::vector<double>> scatter(const int nScatters, Kernel::PseudoRandomNumberGenerator &rng,
                                                 const ComponentWorkspaceMappings &componentWorkspaces,
                                                 const double kinc, const std::vector<double> &wValues,
                                                 bool specialSingleScatterCalc,
                                                 const Mantid::Geometry::DetectorInfo &detectorInfo,
-                                                const size_t &histogramIndex);
+                                                const size_t &histogramIndex, CumulativeProbCache &cumulativeProbs);
 
   Geometry::Track start_point(Kernel::PseudoRandomNumberGenerator &rng);
   Geometry::Track generateInitialTrack(Kernel::PseudoRandomNumberGenerator &rng);
@@ -160,6 +164,9 @@ private:
   void convertToLogWorkspace(const std::shared_ptr<DiscusData2D> &SOfQ);
   void calculateQSQIntegralAsFunctionOfK(ComponentWorkspaceMappings &matWSs, const std::vector<double> &specialKs);
   void prepareCumulativeProbForQ(double kinc, const ComponentWorkspaceMappings &PInvOfQs);
+  const ComponentWorkspaceMappings &cachedCumulativeProbForQ(double k,
+                                                             const ComponentWorkspaceMappings &componentWorkspaces,
+                                                             CumulativeProbCache &cumulativeProbs);
   void prepareQSQ(double kinc);
   double getKf(const double deltaE, const double kinc);
   std::tuple<double, double, int, double> sampleQWUniform(const std::vector<double> &wValues,
@@ -197,6 +204,7 @@ private:
   std::shared_ptr<const Geometry::ReferenceFrame> m_refframe;
   const Geometry::SampleEnvironment *m_env{nullptr};
   bool m_NormalizeSQ{};
+  bool m_radialCollimator{};
   Geometry::BoundingBox m_activeRegion;
   std::unique_ptr<IBeamProfile> m_beamProfile;
   Mantid::Geometry::Instrument_const_sptr m_instrument;
@@ -49,6 +49,14 @@ public:
                          MCInteractionStatistics &stats) override;
 
 private:
+  void calculateWithSharedTracks(Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+                                 const std::vector<double> &lambdas, const double lambdaFixed,
+                                 std::vector<double> &attenuationFactors, std::vector<double> &attFactorErrors,
+                                 MCInteractionStatistics &stats);
+  std::tuple<std::shared_ptr<Geometry::Track>, std::shared_ptr<Geometry::Track>>
+  generateTracks(Kernel::PseudoRandomNumberGenerator &rng, const Geometry::BoundingBox &scatterBounds,
+                 const Kernel::V3D &finalPos, MCInteractionStatistics &stats);
+
   std::shared_ptr<IMCInteractionVolume> m_scatterVol;
   const IBeamProfile &m_beamProfile;
   const size_t m_nevents;
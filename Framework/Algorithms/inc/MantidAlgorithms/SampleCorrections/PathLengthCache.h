@@ -0,0 +1,41 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAlgorithms/DllConfig.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Algorithms {
+
+/** PathLengthCache : stores the path lengths from the volume elements of a
+ * sample to the detectors of each spectrum in a binary file, so that later
+ * absorption corrections of runs with the same sample and detector geometry
+ * do not trace them again.
+ *
+ * A table holds one row per spectrum with one path length per volume element.
+ * Rows of spectra that were not traced, such as masked spectra, are empty.
+ * Files are named after a checksum of everything the path lengths depend on,
+ * which the caller computes, and are kept in the user's application data
+ * directory.
+ */
+namespace PathLengthCache {
+
+/// The path lengths of every volume element for each spectrum
+using Table = std::vector<std::vector<double>>;
+
+MANTID_ALGORITHMS_DLL std::string filePath(const std::string &key);
+MANTID_ALGORITHMS_DLL bool save(const Table &table, const std::string &path);
+MANTID_ALGORITHMS_DLL std::optional<Table> load(const std::string &path, const size_t numberOfSpectra,
+                                                const size_t numberOfElements);
+
+} // namespace PathLengthCache
+} // namespace Algorithms
+} // namespace Mantid
@@ -10,14 +10,18 @@
 #include "MantidAPI/Sample.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
+#include "MantidAlgorithms/SampleCorrections/PathLengthCache.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/SampleEnvironment.h"
+#include "MantidGeometry/Objects/CSGObject.h"
 #include "MantidGeometry/Objects/ShapeFactory.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidHistogramData/Interpolate.h"
+#include "MantidKernel/BinaryStreamWriter.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/ChecksumHelper.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/DeltaEMode.h"
 #include "MantidKernel/Fast_Exponential.h"
@@ -28,6 +32,9 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 
+#include <atomic>
+#include <sstream>
+
 namespace Mantid::Algorithms {
 
 using namespace API;
@@ -195,6 +202,14 @@ void AbsorptionCorrection::exec() {
   }
 
   const auto &spectrumInfo = m_inputWS->spectrumInfo();
+  // Path lengths to the detectors traced by an earlier run with the same
+  // geometry, if they are being cached
+  const auto cachePath = PathLengthCache::filePath(pathLengthCacheKey(spectrumInfo));
+  auto L2Table = PathLengthCache::load(cachePath, numHists, m_numVolumeElements);
+  if (!L2Table && !cachePath.empty())
+    L2Table.emplace(numHists);
+  std::atomic<bool> tracedNewPaths(false);
+
   Progress prog(this, 0.0, 1.0, numHists);
   // Loop over the spectra
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_inputWS, *correctionFactors))
@@ -212,8 +227,17 @@ void AbsorptionCorrection::exec() {
     }
     const auto &det = spectrumInfo.detector(i);
 
-    std::vector<double> L2s(m_numVolumeElements);
-    calculateDistances(det, L2s);
+    std::vector<double> L2s;
+    if (L2Table && !(*L2Table)[i].empty()) {
+      L2s = (*L2Table)[i];
+    } else {
+      L2s.resize(m_numVolumeElements);
+      calculateDistances(det, L2s);
+      if (L2Table) {
+        (*L2Table)[i] = L2s;
+        tracedNewPaths = true;
+      }
+    }
 
     // If an indirect instrument, see if there's an efixed in the parameter map
     double lambdaFixed = m_lambdaFixed;
@@ -270,6 +294,9 @@ void AbsorptionCorrection::exec() {
   }
   PARALLEL_CHECK_INTERRUPT_REGION
 
+  if (tracedNewPaths)
+    PathLengthCache::save(*L2Table, cachePath);
+
   g_log.information() << "Total number of elements in the integration was " << m_L1s.size() << '\n';
   setProperty("OutputWorkspace", correctionFactors);
 
@@ -389,11 +416,11 @@ void AbsorptionCorrection::constructSample(API::Sample &sample) {
   }
 }
 
-/// Calculate the distances traversed by the neutrons within the sample
+/// Find the position used for the path lengths to a detector
 /// @param detector :: The detector we are working on
-/// @param L2s :: A vector of the sample-detector distance for  each segment of
-/// the sample
-void AbsorptionCorrection::calculateDistances(const IDetector &detector, std::vector<double> &L2s) const {
+/// @return The position of the detector, or for grouped detectors a point
+/// at their average angles
+V3D AbsorptionCorrection::detectorPosition(const IDetector &detector) const {
   V3D detectorPos(detector.getPos());
   if (detector.nDets() > 1) {
     // We need to make sure this is right for grouped detectors - should use
@@ -401,6 +428,15 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector, std::ve
     detectorPos.spherical(detectorPos.norm(), detector.getTwoTheta(V3D(), V3D(0, 0, 1)) * 180.0 / M_PI,
                           detector.getPhi() * 180.0 / M_PI);
   }
+  return detectorPos;
+}
+
+/// Calculate the distances traversed by the neutrons within the sample
+/// @param detector :: The detector we are working on
+/// @param L2s :: A vector of the sample-detector distance for  each segment of
+/// the sample
+void AbsorptionCorrection::calculateDistances(const IDetector &detector, std::vector<double> &L2s) const {
+  const V3D detectorPos = detectorPosition(detector);
 
   for (size_t i = 0; i < m_numVolumeElements; ++i) {
     // Create track for distance in cylinder between scattering point and
@@ -412,6 +448,32 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector, std::ve
   }
 }
 
+/// Create the key of the cached path lengths from everything they depend on:
+/// the shape of the sample, its volume elements and the detector positions.
+/// @param spectrumInfo :: The spectra of the input workspace
+/// @return A checksum, or an empty string if the sample shape has no XML
+/// description and the path lengths can not be cached
+std::string AbsorptionCorrection::pathLengthCacheKey(const SpectrumInfo &spectrumInfo) const {
+  const auto *shape = dynamic_cast<const CSGObject *>(m_sampleObject);
+  if (!shape || shape->getShapeXML().empty())
+    return "";
+  std::ostringstream data;
+  BinaryStreamWriter writer(data);
+  writer << name() << shape->getShapeXML();
+  for (const auto &position : m_elementPositions)
+    writer << position.X() << position.Y() << position.Z();
+  writer << static_cast<uint32_t>(spectrumInfo.size());
+  for (size_t i = 0; i < spectrumInfo.size(); ++i) {
+    if (!spectrumInfo.hasDetectors(i)) {
+      writer << static_cast<int32_t>(0);
+      continue;
+    }
+    const V3D position = detectorPosition(spectrumInfo.detector(i));
+    writer << static_cast<int32_t>(1) << position.X() << position.Y() << position.Z();
+  }
+  return ChecksumHelper::sha1FromString(data.str());
+}
+
 // the integrations are done using pairwise summation to reduce
 // issues from adding lots of little numbers together
 // https://en.wikipedia.org/wiki/Pairwise_summation
@@ -26,6 +26,7 @@
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <cfloat>
+#include <cmath>
 
 constexpr double rad2deg = 180.0 / M_PI;
 
@@ -130,6 +131,20 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress, const std::st
   bool warningGiven = false;
 
   const auto &spectrumInfo = inputWS->spectrumInfo();
+  // the angles of all spectra are calculated together and kept with the workspace
+  const std::vector<double> *twoThetas = nullptr;
+  if (thetaType == theta) {
+    twoThetas = &spectrumInfo.twoThetas();
+  } else if (thetaType == signedTheta) {
+    twoThetas = &spectrumInfo.signedTwoThetas();
+  }
+  // an undefined angle is calculated again to report why
+  const auto twoTheta = [&](const size_t i) {
+    const double angle = (*twoThetas)[i];
+    if (!std::isnan(angle))
+      return angle;
+    return thetaType == signedTheta ? spectrumInfo.signedTwoTheta(i) : spectrumInfo.twoTheta(i);
+  };
   for (size_t i = 0; i < spectrumInfo.size(); ++i) {
     if (!spectrumInfo.hasDetectors(i)) {
       if (!warningGiven)
@@ -141,10 +156,8 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress, const std::st
     if (!spectrumInfo.isMonitor(i)) {
       switch (thetaType) {
       case signedTheta:
-        emplaceIndexMap(spectrumInfo.signedTwoTheta(i) * rad2deg, i);
-        break;
       case theta:
-        emplaceIndexMap(spectrumInfo.twoTheta(i) * rad2deg, i);
+        emplaceIndexMap(twoTheta(i) * rad2deg, i);
         break;
       case inPlaneTheta:
         emplaceIndexMap(inPlaneTwoTheta(i, inputWS) * rad2deg, i);
@@ -169,7 +182,7 @@ void ConvertSpectrumAxis2::createThetaMap(API::Progress &progress, const std::st
  * @param inputWS :: input workspace
  */
 double ConvertSpectrumAxis2::inPlaneTwoTheta(const size_t index, const API::MatrixWorkspace_sptr &inputWS) const {
-  const auto spectrumInfo = inputWS->spectrumInfo();
+  const auto &spectrumInfo = inputWS->spectrumInfo();
   const auto refFrame = inputWS->getInstrument()->getReferenceFrame();
   const V3D position = spectrumInfo.position(index) - spectrumInfo.samplePosition();
 
@@ -186,7 +199,7 @@ double ConvertSpectrumAxis2::inPlaneTwoTheta(const size_t index, const API::Matr
  * @param inputWS :: input workspace
  */
 double ConvertSpectrumAxis2::signedInPlaneTwoTheta(const size_t index, const API::MatrixWorkspace_sptr &inputWS) const {
-  const auto spectrumInfo = inputWS->spectrumInfo();
+  const auto &spectrumInfo = inputWS->spectrumInfo();
   const auto refFrame = inputWS->getInstrument()->getReferenceFrame();
 
   const auto samplePos = spectrumInfo.samplePosition();
@@ -218,11 +231,13 @@ void ConvertSpectrumAxis2::createElasticQMap(API::Progress &progress, const std:
 
   const auto &spectrumInfo = inputWS->spectrumInfo();
   const auto &detectorInfo = inputWS->detectorInfo();
+  const auto &twoThetas = spectrumInfo.twoThetas();
   const size_t nHist = spectrumInfo.size();
   for (size_t i = 0; i < nHist; i++) {
     double theta(0.0), efixed(0.0);
     if (!spectrumInfo.isMonitor(i)) {
-      theta = 0.5 * spectrumInfo.twoTheta(i);
+      // an undefined angle is calculated again to report why
+      theta = 0.5 * (std::isnan(twoThetas[i]) ? spectrumInfo.twoTheta(i) : twoThetas[i]);
       /*
        * Two assumptions made in the following code.
        * 1. Getting the detector index of the first detector in the spectrum
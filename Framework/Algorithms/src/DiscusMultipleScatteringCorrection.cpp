@@ -540,6 +540,7 @@ void DiscusMultipleScatteringCorrection::exec() {
   }
 
   m_NormalizeSQ = getProperty("NormalizeStructureFactors");
+  m_radialCollimator = getProperty("RadialCollimator");
 
   const bool useSparseInstrument = getProperty("SparseInstrument");
   SparseWorkspace_sptr sparseWS;
@@ -589,7 +590,10 @@ void DiscusMultipleScatteringCorrection::exec() {
   const auto &spectrumInfo = instrumentWS.spectrumInfo();
   const auto &detectorInfo = instrumentWS.detectorInfo();
 
-  PARALLEL_FOR_IF(enableParallelFor)
+  // the cost of a spectrum varies a lot with its energy range and whether it is masked so hand out spectra one at a
+  // time. Each spectrum keeps its own random number sequence so the results don't depend on the number of threads
+  PARALLEL_SET_CONFIG_THREADS
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (enableParallelFor))
   for (int64_t i = 0; i < static_cast<int64_t>(nhists); ++i) { // signed int for openMP loop
     PARALLEL_START_INTERRUPT_REGION
 
@@ -633,9 +637,10 @@ void DiscusMultipleScatteringCorrection::exec() {
 
         if (m_importanceSampling)
           prepareCumulativeProbForQ(kinc, componentWorkspaces);
+        CumulativeProbCache cumulativeProbs;
 
-        auto [weights, weightsErrors] =
-            simulatePaths(nSingleScatterEvents, 1, rng, componentWorkspaces, kinc, wValues, true, detectorInfo, i);
+        auto [weights, weightsErrors] = simulatePaths(nSingleScatterEvents, 1, rng, componentWorkspaces, kinc, wValues,
+                                                      true, detectorInfo, i, cumulativeProbs);
         if (std::get<1>(kInW[bin]) == -1) {
           noAbsSimulationWS->getSpectrum(i).mutableY() += weights;
           noAbsSimulationWS->getSpectrum(i).mutableE() += weightsErrors;
@@ -647,8 +652,8 @@ void DiscusMultipleScatteringCorrection::exec() {
         for (int ne = 0; ne < nScatters; ne++) {
           int nEvents = ne == 0 ? nSingleScatterEvents : nMultiScatterEvents;
 
-          std::tie(weights, weightsErrors) =
-              simulatePaths(nEvents, ne + 1, rng, componentWorkspaces, kinc, wValues, false, detectorInfo, i);
+          std::tie(weights, weightsErrors) = simulatePaths(nEvents, ne + 1, rng, componentWorkspaces, kinc, wValues,
+                                                           false, detectorInfo, i, cumulativeProbs);
           if (std::get<1>(kInW[bin]) == -1.0) {
             simulationWSs[ne]->getSpectrum(i).mutableY() += weights;
             simulationWSs[ne]->getSpectrum(i).mutableE() += weightsErrors;
@@ -964,6 +969,33 @@ void DiscusMultipleScatteringCorrection::prepareCumulativeProbForQ(
   }
 }
 
+/**
+ * Look up the cumulative probability distribution for a wavevector reached after an inelastic scatter, calculating
+ * it if it hasn't been needed before. Only a few distinct wavevectors can be reached from each incident wavevector
+ * because the energy transfers are drawn from the w values in S(Q,w) so most lookups find an existing distribution
+ * @param k The incident wavevector of the next scatter
+ * @param componentWorkspaces List of workspaces for each material, used as a template for new distributions
+ * @param cumulativeProbs The distributions calculated so far for the current incident wavevector
+ * @return List of workspaces for each material with the inverted cumulative probability distribution for k
+ */
+const DiscusMultipleScatteringCorrection::ComponentWorkspaceMappings &
+DiscusMultipleScatteringCorrection::cachedCumulativeProbForQ(double k,
+                                                             const ComponentWorkspaceMappings &componentWorkspaces,
+                                                             CumulativeProbCache &cumulativeProbs) {
+  // bound the memory used when there are many scatters and hence many reachable wavevectors
+  constexpr size_t MAX_CACHED_DISTRIBUTIONS = 64;
+  auto cached = cumulativeProbs.find(k);
+  if (cached == cumulativeProbs.end()) {
+    if (cumulativeProbs.size() >= MAX_CACHED_DISTRIBUTIONS)
+      cumulativeProbs.clear();
+    auto newComponentWorkspaces = componentWorkspaces;
+    createInvPOfQWorkspaces(newComponentWorkspaces, 2);
+    prepareCumulativeProbForQ(k, newComponentWorkspaces);
+    cached = cumulativeProbs.emplace(k, std::move(newComponentWorkspaces)).first;
+  }
+  return cached->second;
+}
+
 void DiscusMultipleScatteringCorrection::convertToLogWorkspace(const std::shared_ptr<DiscusData2D> &SOfQ) {
   // generate log of the structure factor to support gaussian interpolation
 
@@ -1208,8 +1240,25 @@ std::tuple<double, double> DiscusMultipleScatteringCorrection::new_vector(const
  */
 std::tuple<double, int>
 DiscusMultipleScatteringCorrection::sampleQW(const std::shared_ptr<DiscusData2D> &CumulativeProb, double x) {
-  return {interpolateSquareRoot(CumulativeProb->histogram(0), x),
-          static_cast<int>(interpolateFlat(CumulativeProb->histogram(1), x))};
+  // both spectra share the same x values so locate x once and use it for both lookups. This gives the same result as
+  // interpolateSquareRoot and interpolateFlat
+  const auto &qHisto = CumulativeProb->histogram(0);
+  const auto &wIndexHisto = CumulativeProb->histogram(1);
+  const auto &histx = qHisto.X;
+  if (x < histx.front())
+    return {qHisto.Y.front(), static_cast<int>(wIndexHisto.Y.front())};
+  const auto iter = std::upper_bound(histx.cbegin(), histx.cend(), x);
+  if (iter == histx.cend())
+    return {qHisto.Y.back(), static_cast<int>(wIndexHisto.Y.back())};
+  const auto idx = static_cast<size_t>(std::distance(histx.cbegin(), iter) - 1);
+  const double x0 = histx[idx];
+  const double y0 = qHisto.Y[idx];
+  const double asq = (qHisto.Y[idx + 1] * qHisto.Y[idx + 1] - y0 * y0) / (histx[idx + 1] - x0);
+  if (asq == 0.) {
+    throw std::runtime_error("Cannot perform square root interpolation on supplied distribution");
+  }
+  const double b = x0 - y0 * y0 / asq;
+  return {sqrt(asq * (x - b)), static_cast<int>(wIndexHisto.Y[idx])};
 }
 
 /**
@@ -1362,7 +1411,8 @@ GNU_DIAG_OFF("free-nonheap-object")
 std::tuple<std::vector<double>, std::vector<double>> DiscusMultipleScatteringCorrection::simulatePaths(
     const int nPaths, const int nScatters, Kernel::PseudoRandomNumberGenerator &rng,
     const ComponentWorkspaceMappings &componentWorkspaces, const double kinc, const std::vector<double> &wValues,
-    bool specialSingleScatterCalc, const Mantid::Geometry::DetectorInfo &detectorInfo, const size_t &histogramIndex) {
+    bool specialSingleScatterCalc, const Mantid::Geometry::DetectorInfo &detectorInfo, const size_t &histogramIndex,
+    CumulativeProbCache &cumulativeProbs) {
   // countZeroWeights for debugging and analysis of where importance sampling may help
   std::vector<int> countZeroWeights(wValues.size(), 0);
   std::vector<double> sumOfWeights(wValues.size(), 0.);
@@ -1371,7 +1421,7 @@ std::tuple<std::vector<double>, std::vector<double>> DiscusMultipleScatteringCor
 
   for (int ie = 0; ie < nPaths; ie++) {
     auto [success, weights] = scatter(nScatters, rng, componentWorkspaces, kinc, wValues, specialSingleScatterCalc,
-                                      detectorInfo, histogramIndex);
+                                      detectorInfo, histogramIndex, cumulativeProbs);
     if (success) {
       std::transform(weights.begin(), weights.end(), sumOfWeights.begin(), sumOfWeights.begin(), std::plus<double>());
       std::transform(weights.begin(), weights.end(), countZeroWeights.begin(), countZeroWeights.begin(),
@@ -1421,7 +1471,8 @@ GNU_DIAG_ON("free-nonheap-object")
 std::tuple<bool, std::vector<double>> DiscusMultipleScatteringCorrection::scatter(
     const int nScatters, Kernel::PseudoRandomNumberGenerator &rng,
     const ComponentWorkspaceMappings &componentWorkspaces, const double kinc, const std::vector<double> &wValues,
-    bool specialSingleScatterCalc, const Mantid::Geometry::DetectorInfo &detectorInfo, const size_t &histogramIndex) {
+    bool specialSingleScatterCalc, const Mantid::Geometry::DetectorInfo &detectorInfo, const size_t &histogramIndex,
+    CumulativeProbCache &cumulativeProbs) {
 
   double weight = 1;
 
@@ -1432,18 +1483,12 @@ std::tuple<bool, std::vector<double>> DiscusMultipleScatteringCorrection::scatte
   std::tie(std::ignore, scatteringXSection) =
       new_vector(shapeObjectWithScatter->material(), kinc, specialSingleScatterCalc);
 
-  auto currentComponentWorkspaces = componentWorkspaces;
   double k = kinc;
   for (int iScat = 0; iScat < nScatters - 1; iScat++) {
-    if ((k != kinc)) {
-      if (m_importanceSampling) {
-        auto newComponentWorkspaces = componentWorkspaces;
-        for (auto &SQWSMapping : currentComponentWorkspaces)
-          SQWSMapping.InvPOfQ = SQWSMapping.InvPOfQ->createCopy();
-        prepareCumulativeProbForQ(k, newComponentWorkspaces);
-        currentComponentWorkspaces = std::move(newComponentWorkspaces);
-      }
-    }
+    // componentWorkspaces holds the Q distribution for kinc so only look another one up after an inelastic scatter
+    const auto &currentComponentWorkspaces = (m_importanceSampling && k != kinc)
+                                                 ? cachedCumulativeProbForQ(k, componentWorkspaces, cumulativeProbs)
+                                                 : componentWorkspaces;
     auto trackStillAlive =
         q_dir(track, shapeObjectWithScatter, currentComponentWorkspaces, k, scatteringXSection, rng, weight);
     if (!trackStillAlive)
@@ -1463,8 +1508,7 @@ std::tuple<bool, std::vector<double>> DiscusMultipleScatteringCorrection::scatte
         new_vector(shapeObjectWithScatter->material(), k, specialSingleScatterCalc);
   }
 
-  bool considerCollimator = getProperty("RadialCollimator");
-  if (considerCollimator) {
+  if (m_radialCollimator) {
     const auto &samplePos = detectorInfo.samplePosition();
     auto hexahedron = createCollimatorHexahedronShape(samplePos, detectorInfo, histogramIndex);
     // zero the paths if the final scatter point is not inside the collimatorCorridor shape or the collimator shape is
@@ -1492,6 +1536,7 @@ std::tuple<bool, std::vector<double>> DiscusMultipleScatteringCorrection::scatte
   }
   std::vector<double> weights;
   auto scatteringXSectionFull = shapeObjectWithScatter->material().totalScatterXSection();
+  const auto &componentWSMapping = *findMatchingComponent(componentWorkspaces, shapeObjectWithScatter);
   // Step through required overall energy transfer (w) values and work out what
   // w that means for the final scatter. There will be a single w value for elastic
   // Slightly different approach to original DISCUS code. It stepped through the w values
@@ -1506,8 +1551,6 @@ std::tuple<bool, std::vector<double>> DiscusMultipleScatteringCorrection::scatte
       const auto qVector = directionToDetector * kout - prevDirection * k;
       const double q = qVector.norm();
       const double finalW = fromWaveVector(k) - finalE;
-      auto componentWSIt = findMatchingComponent(componentWorkspaces, shapeObjectWithScatter);
-      auto &componentWSMapping = *componentWSIt; // to help debugging
       double SQ = Interpolate2D(componentWSMapping, q, finalW);
       scatteringXSection = m_NormalizeSQ ? scatteringXSection / interpolateFlat(*(componentWSMapping.QSQScaleFactor), k)
                                          : scatteringXSectionFull;
@@ -27,6 +27,9 @@
 
 #include "MantidTypes/SpectrumDefinition.h"
 
+#include <limits>
+#include <map>
+
 using Mantid::HistogramData::HistogramX;
 
 namespace Mantid::Algorithms {
@@ -665,25 +668,34 @@ void MergeRuns::fillHistory() {
  *time indexes are set here.
  *
  *This function translates time indices from the addee to the new workspace.
+ *The translation table is built once from the scan intervals, so the cost is
+ *linear in the number of spectra and scan points.
  */
 std::vector<SpectrumDefinition> MergeRuns::buildScanIntervals(const std::vector<SpectrumDefinition> &addeeSpecDefs,
                                                               const DetectorInfo &addeeDetInfo,
                                                               const DetectorInfo &newOutDetInfo) {
   std::vector<SpectrumDefinition> newAddeeSpecDefs(addeeSpecDefs.size());
 
-  auto addeeScanIntervals = addeeDetInfo.scanIntervals();
-  auto newOutScanIntervals = newOutDetInfo.scanIntervals();
+  const auto addeeScanIntervals = addeeDetInfo.scanIntervals();
+  const auto newOutScanIntervals = newOutDetInfo.scanIntervals();
+
+  std::map<std::pair<Types::Core::DateAndTime, Types::Core::DateAndTime>, size_t> newOutTimeIndices;
+  for (size_t time_index = 0; time_index < newOutScanIntervals.size(); ++time_index)
+    newOutTimeIndices.emplace(newOutScanIntervals[time_index], time_index);
+  constexpr auto noTimeIndex = std::numeric_limits<size_t>::max();
+  std::vector<size_t> newTimeIndices(addeeScanIntervals.size(), noTimeIndex);
+  for (size_t time_index = 0; time_index < addeeScanIntervals.size(); ++time_index) {
+    const auto match = newOutTimeIndices.find(addeeScanIntervals[time_index]);
+    if (match != newOutTimeIndices.end())
+      newTimeIndices[time_index] = match->second;
+  }
 
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t i = 0; i < int64_t(addeeSpecDefs.size()); ++i) {
     for (auto const &index : addeeSpecDefs[i]) {
-      SpectrumDefinition newSpecDef;
-      for (size_t time_index = 0; time_index < newOutDetInfo.scanCount(); time_index++) {
-        if (addeeScanIntervals[index.second] == newOutScanIntervals[time_index]) {
-          newSpecDef.add(index.first, time_index);
-        }
-      }
-      newAddeeSpecDefs[i] = newSpecDef;
+      const auto time_index = newTimeIndices[index.second];
+      if (time_index != noTimeIndex)
+        newAddeeSpecDefs[i].add(index.first, time_index);
     }
   }
 
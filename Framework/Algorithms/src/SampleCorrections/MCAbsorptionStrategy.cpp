@@ -6,10 +6,15 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/SampleCorrections/MCAbsorptionStrategy.h"
 #include "MantidAlgorithms/SampleCorrections/IBeamProfile.h"
+#include "MantidKernel/Material.h"
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 #include "MantidKernel/V3D.h"
 
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Mantid {
 using Kernel::DeltaEMode;
@@ -17,6 +22,23 @@ using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+/**
+ * Create the error thrown when no track can be generated
+ * @param maxScatterPtAttempts The number of tries made
+ */
+std::runtime_error trackGenerationFailure(const size_t maxScatterPtAttempts) {
+  return std::runtime_error("Unable to generate valid track through "
+                            "sample interaction volume after " +
+                            std::to_string(maxScatterPtAttempts) +
+                            " attempts. Try increasing the maximum "
+                            "threshold or if this does not help then "
+                            "please check the defined shape and, "
+                            "if defined, the gauge volume (both its shape "
+                            "and its intersection with the defined sample shape).");
+}
+} // namespace
+
 /**
  * Constructor
  * @param interactionVolume A reference to the MCInteractionVolume dependency
@@ -69,6 +91,10 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
                                      const std::vector<double> &lambdas, const double lambdaFixed,
                                      std::vector<double> &attenuationFactors, std::vector<double> &attFactorErrors,
                                      MCInteractionStatistics &stats) {
+  if (!m_regenerateTracksForEachLambda) {
+    calculateWithSharedTracks(rng, finalPos, lambdas, lambdaFixed, attenuationFactors, attFactorErrors, stats);
+    return;
+  }
   const auto scatterBounds = m_scatterVol->getFullBoundingBox();
   const auto nbins = static_cast<int>(lambdas.size());
   Geometry::IObject_sptr gv = m_scatterVol->getGaugeVolume();
@@ -82,13 +108,9 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
       size_t attempts(0);
       do {
         bool success = false;
-        if (m_regenerateTracksForEachLambda || j == 0) {
-          const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
-          std::tie(success, beforeScatter, afterScatter) =
-              m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
-        } else {
-          success = true;
-        }
+        const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+        std::tie(success, beforeScatter, afterScatter) =
+            m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
         if (!success) {
           ++attempts;
         } else {
@@ -115,14 +137,7 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
           break;
         }
         if (attempts == m_maxScatterAttempts) {
-          throw std::runtime_error("Unable to generate valid track through "
-                                   "sample interaction volume after " +
-                                   std::to_string(m_maxScatterAttempts) +
-                                   " attempts. Try increasing the maximum "
-                                   "threshold or if this does not help then "
-                                   "please check the defined shape and, "
-                                   "if defined, the gauge volume (both its shape "
-                                   "and its intersection with the defined sample shape).");
+          throw trackGenerationFailure(m_maxScatterAttempts);
         }
       } while (true);
     }
@@ -136,5 +151,127 @@ void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng, c
                  [this](double v) -> double { return v / sqrt(static_cast<double>(m_nevents)); });
 }
 
+/**
+ * Compute the correction using one pair of tracks per event for every
+ * wavelength. The attenuation coefficient of each object is looked up once
+ * per wavelength rather than once per event, and the path length of each
+ * event through each object is gathered once, so that the work per
+ * wavelength is a short loop over contiguous arrays.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdas Set of wavelength values from the input workspace
+ * @param lambdaFixed Efixed value for a detector ID converted to wavelength
+ * @param attenuationFactors A vector containing the calculated correction
+ * factors
+ * @param attFactorErrors A vector containing the calculated correction factor
+ * errors
+ * @param stats A statistics class to hold the statistics on the generated
+ * tracks
+ */
+void MCAbsorptionStrategy::calculateWithSharedTracks(Kernel::PseudoRandomNumberGenerator &rng,
+                                                     const Kernel::V3D &finalPos, const std::vector<double> &lambdas,
+                                                     const double lambdaFixed, std::vector<double> &attenuationFactors,
+                                                     std::vector<double> &attFactorErrors,
+                                                     MCInteractionStatistics &stats) {
+  const auto scatterBounds = m_scatterVol->getFullBoundingBox();
+  const size_t nbins = lambdas.size();
+  std::vector<double> lambdasIn(lambdas), lambdasOut(lambdas);
+  if (m_EMode == DeltaEMode::Direct) {
+    std::fill(lambdasIn.begin(), lambdasIn.end(), lambdaFixed);
+  } else if (m_EMode == DeltaEMode::Indirect) {
+    std::fill(lambdasOut.begin(), lambdasOut.end(), lambdaFixed);
+  }
+
+  // Attenuation coefficients at each wavelength before and after scattering
+  // for every object met so far
+  std::vector<const Geometry::IObject *> objects;
+  std::vector<std::vector<double>> coefficientsIn, coefficientsOut;
+  // Path lengths of the current event through each object
+  std::vector<double> pathsIn, pathsOut;
+  const auto addPaths = [&](const Geometry::Track &track, std::vector<double> &paths) {
+    for (const auto &link : track) {
+      const auto it = std::find(objects.cbegin(), objects.cend(), link.object);
+      const auto index = static_cast<size_t>(std::distance(objects.cbegin(), it));
+      if (it == objects.cend()) {
+        objects.emplace_back(link.object);
+        const auto &material = link.object->material();
+        const auto coefficient = [&material](const double lambda) { return material.attenuationCoefficient(lambda); };
+        coefficientsIn.emplace_back(nbins);
+        std::transform(lambdasIn.cbegin(), lambdasIn.cend(), coefficientsIn.back().begin(), coefficient);
+        coefficientsOut.emplace_back(nbins);
+        std::transform(lambdasOut.cbegin(), lambdasOut.cend(), coefficientsOut.back().begin(), coefficient);
+        pathsIn.emplace_back(0.);
+        pathsOut.emplace_back(0.);
+      }
+      paths[index] += link.distInsideObject;
+    }
+  };
+
+  std::vector<double> exponents(nbins), weights(nbins), wgtMean(nbins), wgtM2(nbins);
+  for (size_t i = 0; i < m_nevents; ++i) {
+    const auto [beforeScatter, afterScatter] = generateTracks(rng, scatterBounds, finalPos, stats);
+    std::fill(pathsIn.begin(), pathsIn.end(), 0.);
+    std::fill(pathsOut.begin(), pathsOut.end(), 0.);
+    addPaths(*beforeScatter, pathsIn);
+    addPaths(*afterScatter, pathsOut);
+
+    std::fill(exponents.begin(), exponents.end(), 0.);
+    for (size_t k = 0; k < objects.size(); ++k) {
+      const double pathIn = pathsIn[k], pathOut = pathsOut[k];
+      const double *coefficientIn = coefficientsIn[k].data();
+      const double *coefficientOut = coefficientsOut[k].data();
+      for (size_t j = 0; j < nbins; ++j) {
+        exponents[j] += coefficientIn[j] * pathIn + coefficientOut[j] * pathOut;
+      }
+    }
+    for (size_t j = 0; j < nbins; ++j) {
+      weights[j] = std::exp(-exponents[j]);
+    }
+
+    const auto count = static_cast<double>(i + 1);
+    for (size_t j = 0; j < nbins; ++j) {
+      const double wgt = weights[j];
+      attenuationFactors[j] += wgt;
+      // increment standard deviation using Welford algorithm
+      const double delta = wgt - wgtMean[j];
+      wgtMean[j] += delta / count;
+      wgtM2[j] += delta * (wgt - wgtMean[j]);
+    }
+  }
+
+  // calculate sample SD (M2/n-1) and from it the standard deviation of the
+  // mean. This gives NaN for m_events=1, but that's correct
+  const auto nevents = static_cast<double>(m_nevents);
+  for (size_t j = 0; j < nbins; ++j) {
+    attenuationFactors[j] /= nevents;
+    attFactorErrors[j] = std::sqrt(wgtM2[j] / (nevents - 1.)) / std::sqrt(nevents);
+  }
+}
+
+/**
+ * Generate the tracks before and after scattering for one event, retrying
+ * until a valid pair is found
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param scatterBounds The bounding box of the interaction volume
+ * @param finalPos Defines the final position of the neutron
+ * @param stats A statistics class to hold the statistics on the generated
+ * tracks
+ * @return The tracks before and after scattering
+ */
+std::tuple<std::shared_ptr<Geometry::Track>, std::shared_ptr<Geometry::Track>>
+MCAbsorptionStrategy::generateTracks(Kernel::PseudoRandomNumberGenerator &rng,
+                                     const Geometry::BoundingBox &scatterBounds, const Kernel::V3D &finalPos,
+                                     MCInteractionStatistics &stats) {
+  for (size_t attempts = 0; attempts < m_maxScatterAttempts; ++attempts) {
+    const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+    auto [success, beforeScatter, afterScatter] =
+        m_scatterVol->calculateBeforeAfterTrack(rng, neutron.startPos, finalPos, stats);
+    if (success)
+      return {std::move(beforeScatter), std::move(afterScatter)};
+  }
+  throw trackGenerationFailure(m_maxScatterAttempts);
+}
+
 } // namespace Algorithms
 } // namespace Mantid
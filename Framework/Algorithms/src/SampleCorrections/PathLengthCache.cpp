@@ -0,0 +1,132 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidAlgorithms/SampleCorrections/PathLengthCache.h"
+#include "MantidKernel/BinaryStreamReader.h"
+#include "MantidKernel/BinaryStreamWriter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+
+#include <Poco/Process.h>
+
+#include <filesystem>
+#include <fstream>
+
+using Mantid::Kernel::BinaryStreamReader;
+using Mantid::Kernel::BinaryStreamWriter;
+
+namespace Mantid::Algorithms::PathLengthCache {
+
+namespace {
+Kernel::Logger g_log("PathLengthCache");
+
+/// Identifies the files, followed by the format version
+const std::string MAGIC = "MantidPathLengths";
+/// Increase whenever the layout of the file changes
+constexpr uint32_t FORMAT_VERSION = 1;
+/// Written last so that truncated files are rejected
+const std::string END_MARKER = "EndOfPathLengths";
+/// Subdirectory of the application data directory holding the files
+const std::string DIRECTORY = "pathlengths";
+} // namespace
+
+/** Find where the path lengths with a given key are kept.
+ * @param key :: a checksum of the sample, its volume elements and the
+ * detector positions
+ * @return the path of the file, or an empty string if the
+ * absorptionCorrection.pathLengthCache setting turns the cache off
+ */
+std::string filePath(const std::string &key) {
+  auto &config = Kernel::ConfigService::Instance();
+  if (key.empty() || !config.getValue<bool>("absorptionCorrection.pathLengthCache").value_or(false))
+    return "";
+  return (std::filesystem::path(config.getAppDataDir()) / DIRECTORY / (key + ".pathlengths")).string();
+}
+
+/** Write a table of path lengths to a cache file. The file is written under a
+ * temporary name and then renamed so that other processes never read a
+ * partial file.
+ * @param table :: the path lengths, one row per spectrum
+ * @param path :: the file to write
+ * @return true if the file was written
+ */
+bool save(const Table &table, const std::string &path) {
+  if (path.empty())
+    return false;
+  const std::string partialPath = path + "." + std::to_string(Poco::Process::id()) + ".part";
+  try {
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+    {
+      std::ofstream file(partialPath, std::ios::binary | std::ios::trunc);
+      BinaryStreamWriter writer(file);
+      writer.write(MAGIC, MAGIC.size());
+      writer << FORMAT_VERSION << static_cast<uint32_t>(table.size());
+      for (const auto &row : table) {
+        writer << static_cast<uint32_t>(row.size());
+        writer.write(row, row.size());
+      }
+      writer.write(END_MARKER, END_MARKER.size());
+      if (file.fail())
+        throw std::runtime_error("unable to write " + partialPath);
+    }
+    std::filesystem::rename(partialPath, path);
+  } catch (std::exception &e) {
+    g_log.warning() << "Unable to cache path lengths in " << path << ": " << e.what() << '\n';
+    std::error_code ignored;
+    std::filesystem::remove(partialPath, ignored);
+    return false;
+  }
+  g_log.debug() << "Cached path lengths in " << path << '\n';
+  return true;
+}
+
+/** Read a table of path lengths from a cache file.
+ * @param path :: the file written by save()
+ * @param numberOfSpectra :: the number of rows the table must have
+ * @param numberOfElements :: the length of every row that is not empty
+ * @return the table, or nothing if there is no usable file
+ */
+std::optional<Table> load(const std::string &path, const size_t numberOfSpectra, const size_t numberOfElements) {
+  if (path.empty())
+    return std::nullopt;
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+    return std::nullopt;
+  try {
+    file.exceptions(std::ios::failbit | std::ios::badbit);
+    BinaryStreamReader reader(file);
+    std::string magic;
+    uint32_t version, numberOfRows;
+    reader.read(magic, MAGIC.size());
+    if (magic != MAGIC)
+      throw std::runtime_error("not a path length cache file");
+    reader >> version;
+    if (version != FORMAT_VERSION)
+      throw std::runtime_error("written with format version " + std::to_string(version));
+    reader >> numberOfRows;
+    if (numberOfRows != numberOfSpectra)
+      throw std::runtime_error("holds " + std::to_string(numberOfRows) + " spectra");
+
+    Table table(numberOfSpectra);
+    for (auto &row : table) {
+      uint32_t rowSize;
+      reader >> rowSize;
+      if (rowSize != 0 && rowSize != numberOfElements)
+        throw std::runtime_error("holds " + std::to_string(rowSize) + " volume elements");
+      reader.read(row, rowSize);
+    }
+    std::string endMarker;
+    reader.read(endMarker, END_MARKER.size());
+    if (endMarker != END_MARKER)
+      throw std::runtime_error("the file is incomplete");
+    return table;
+  } catch (std::exception &e) {
+    g_log.warning() << "Ignoring the path length cache file " << path << ": " << e.what() << '\n';
+    return std::nullopt;
+  }
+}
+
+} // namespace Mantid::Algorithms::PathLengthCache
@@ -14,11 +14,14 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <atomic>
+#include <unordered_map>
 
 namespace Mantid::Algorithms {
 
@@ -102,18 +105,58 @@ protected:
   std::unique_ptr<const AlphaAngleCalculator> m_alphaAngleCalculator;
 };
 
+/**
+ * Uses the shape of each detector. Detectors are grouped by their shape and
+ * cuboids and cylinders are triangulated once per shape rather than for every
+ * detector.
+ */
 struct GenericShape : public SolidAngleCalculator {
   using SolidAngleCalculator::SolidAngleCalculator;
   GenericShape(const ComponentInfo &componentInfo, const DetectorInfo &detectorInfo, const std::string &method,
                const double pixelArea, const int numberOfCylinderSlices)
       : SolidAngleCalculator(componentInfo, detectorInfo, method, pixelArea),
-        m_numberOfCylinderSlices(numberOfCylinderSlices) {}
+        m_params(m_samplePos, numberOfCylinderSlices) {
+    for (size_t index = 0; index < detectorInfo.size(); ++index) {
+      if (!componentInfo.hasValidShape(index))
+        continue;
+      const auto &shape = componentInfo.shape(index);
+      if (m_shapeTriangles.find(&shape) != m_shapeTriangles.end())
+        continue;
+      const auto csgShape = dynamic_cast<const CSGObject *>(&shape);
+      m_shapeTriangles.emplace(&shape, csgShape ? csgShape->solidAngleTriangles(numberOfCylinderSlices)
+                                                : std::vector<V3D>());
+    }
+  }
   double solidAngle(size_t index) const override {
-    return m_detectorInfo.detector(index).solidAngle(Geometry::SolidAngleParams(m_samplePos, m_numberOfCylinderSlices));
+    if (!m_componentInfo.hasValidShape(index))
+      return m_componentInfo.solidAngle(index, m_params);
+    const auto &shape = m_componentInfo.shape(index);
+    const auto &triangles = m_shapeTriangles.at(&shape);
+    const V3D scaleFactor = m_componentInfo.scaleFactor(index);
+    if (triangles.empty() || (scaleFactor - V3D(1.0, 1.0, 1.0)).norm() >= 1e-12)
+      return m_componentInfo.solidAngle(index, m_params);
+    // put the sample into the frame of the shape
+    V3D observer = m_samplePos - m_componentInfo.position(index);
+    auto unrotate = m_componentInfo.rotation(index);
+    unrotate.inverse();
+    unrotate.rotate(observer);
+    const auto &boundingBox = shape.getBoundingBox();
+    if (boundingBox.isNonNull() && boundingBox.isPointInside(observer))
+      return m_componentInfo.solidAngle(index, m_params);
+    double solidAngle = 0.0;
+    for (size_t i = 0; i < triangles.size(); i += 3) {
+      const double triangleSolidAngle =
+          MeshObjectCommon::getTriangleSolidAngle(triangles[i], triangles[i + 1], triangles[i + 2], observer);
+      if (triangleSolidAngle > 0.0)
+        solidAngle += triangleSolidAngle;
+    }
+    return solidAngle;
   }
 
 private:
-  int m_numberOfCylinderSlices;
+  const Geometry::SolidAngleParams m_params;
+  /// The triangles summed for the solid angle of each shape, empty if the shape calculates it itself
+  std::unordered_map<const IObject *, std::vector<V3D>> m_shapeTriangles;
 };
 
 struct Rectangle : public SolidAngleCalculator {
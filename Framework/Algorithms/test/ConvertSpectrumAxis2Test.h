@@ -17,6 +17,7 @@
 #include "MantidDataHandling/MoveInstrumentComponent.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/Unit.h"
 
 using namespace Mantid::API;
@@ -226,6 +227,41 @@ public:
     clean_up_workspaces(inputWS, outputWS2);
   }
 
+  void test_Target_Theta_Follows_Moved_Detectors() {
+    auto testWS = WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 1, false);
+    const auto thetaAxis = [&testWS]() {
+      Mantid::Algorithms::ConvertSpectrumAxis2 conv;
+      conv.initialize();
+      conv.setChild(true);
+      conv.setProperty("InputWorkspace", testWS);
+      conv.setPropertyValue("OutputWorkspace", "out");
+      conv.setPropertyValue("Target", "Theta");
+      conv.execute();
+      MatrixWorkspace_sptr output = conv.getProperty("OutputWorkspace");
+      std::vector<double> values;
+      for (size_t i = 0; i < output->getNumberHistograms(); ++i)
+        values.emplace_back((*output->getAxis(1))(i));
+      return values;
+    };
+    const auto expectedAxis = [&testWS]() {
+      std::vector<double> values;
+      const auto &spectrumInfo = testWS->spectrumInfo();
+      for (size_t i = 0; i < spectrumInfo.size(); ++i)
+        values.emplace_back(spectrumInfo.twoTheta(i) * 180.0 / M_PI);
+      std::sort(values.begin(), values.end());
+      return values;
+    };
+
+    const auto before = thetaAxis();
+    testWS->mutableDetectorInfo().setPosition(1, Mantid::Kernel::V3D(0.5, 0., 1.));
+    const auto after = thetaAxis();
+    TS_ASSERT_DIFFERS(after, before);
+    const auto expected = expectedAxis();
+    TS_ASSERT_EQUALS(after.size(), expected.size());
+    for (size_t i = 0; i < std::min(after.size(), expected.size()); ++i)
+      TS_ASSERT_DELTA(after[i], expected[i], 1e-10);
+  }
+
   void test_Target_InPlaneTwoTheta_Returns_Correct_Value() {
     const std::string inputWS("inWS");
     const std::string outputWS("outWS");
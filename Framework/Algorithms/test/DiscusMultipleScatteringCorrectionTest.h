@@ -38,6 +38,12 @@ public:
   double interpolateSquareRoot(const DiscusData1D &histToInterpolate, double x) {
     return DiscusMultipleScatteringCorrection::interpolateSquareRoot(histToInterpolate, x);
   }
+  double interpolateFlat(const DiscusData1D &histToInterpolate, double x) {
+    return DiscusMultipleScatteringCorrection::interpolateFlat(histToInterpolate, x);
+  }
+  std::tuple<double, int> sampleQW(const std::shared_ptr<DiscusData2D> &CumulativeProb, double x) {
+    return DiscusMultipleScatteringCorrection::sampleQW(CumulativeProb, x);
+  }
   void updateTrackDirection(Mantid::Geometry::Track &track, const double cosT, const double phi) {
     DiscusMultipleScatteringCorrection::updateTrackDirection(track, cosT, phi);
   }
@@ -418,6 +424,20 @@ public:
     TS_ASSERT_EQUALS(interpY, 3.0);
   }
 
+  void test_sampleQW_matches_separate_interpolation_of_Q_and_w() {
+    DiscusMultipleScatteringCorrectionHelper alg;
+
+    const std::vector<double> cumulativeProb{0., 0.1, 0.1, 0.45, 0.8, 1.};
+    const DiscusData1D qValues{cumulativeProb, {0., 0.5, 0.7, 1.2, 2., 2.5}};
+    const DiscusData1D wIndices{cumulativeProb, {0., 0., 1., 1., 2., 2.}};
+    auto invPOfQ = std::make_shared<DiscusData2D>(std::vector<DiscusData1D>{qValues, wIndices}, nullptr);
+    for (const double x : {0., 0.05, 0.1, 0.3, 0.45, 0.79, 0.999}) {
+      auto [q, iW] = alg.sampleQW(invPOfQ, x);
+      TS_ASSERT_EQUALS(q, alg.interpolateSquareRoot(qValues, x));
+      TS_ASSERT_EQUALS(iW, static_cast<int>(alg.interpolateFlat(wIndices, x)));
+    }
+  }
+
   void test_updateTrackDirection() {
     DiscusMultipleScatteringCorrectionHelper alg;
     const double twoTheta = M_PI * 60. / 180.;
@@ -21,6 +21,7 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidTypes/SpectrumDefinition.h"
 #include <memory>
@@ -1425,6 +1426,45 @@ public:
     assert_scanning_histograms_correctly_set(outputWS);
   }
 
+  void test_merging_detector_scan_workspaces_with_grouped_spectra_keeps_every_detector() {
+    auto ws = create_group_detector_scan_workspaces(2, 20);
+    // Group both detectors of each time index into one spectrum of the second workspace
+    auto b = std::dynamic_pointer_cast<MatrixWorkspace>(ws->getItem(1));
+    std::vector<SpectrumDefinition> grouped(4);
+    grouped[0].add(0, 0);
+    grouped[0].add(1, 0);
+    grouped[1].add(0, 1);
+    grouped[1].add(1, 1);
+    grouped[2].add(0, 0);
+    grouped[3].add(1, 1);
+    auto indexInfo = b->indexInfo();
+    indexInfo.setSpectrumDefinitions(grouped);
+    b->setIndexInfo(indexInfo);
+
+    MergeRuns alg;
+    alg.initialize();
+    alg.setPropertyValue("InputWorkspaces", ws->getName());
+    alg.setPropertyValue("OutputWorkspace", "outWS");
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    MatrixWorkspace_sptr outputWS;
+    TS_ASSERT_THROWS_NOTHING(outputWS = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>("outWS"));
+
+    const auto &specInfo = outputWS->spectrumInfo();
+    TS_ASSERT_EQUALS(specInfo.size(), 8)
+    // the time indices of the second workspace follow those of the first
+    std::vector<SpectrumDefinition> expected(4);
+    expected[0].add(0, 2);
+    expected[0].add(1, 2);
+    expected[1].add(0, 3);
+    expected[1].add(1, 3);
+    expected[2].add(0, 2);
+    expected[3].add(1, 3);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      TS_ASSERT_EQUALS(specInfo.spectrumDefinition(i + 4), expected[i])
+    }
+    TS_ASSERT_EQUALS(specInfo.spectrumDefinition(0)[0], (std::pair<size_t, size_t>(0, 0)))
+  }
+
   void test_merging_detector_scan_workspaces_with_overlapping_time_intervals_throws() {
     auto ws = create_group_detector_scan_workspaces(2, 1);
 
@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAlgorithms/SampleCorrections/PathLengthCache.h"
+#include "MantidKernel/ConfigService.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Mantid::Algorithms;
+using Mantid::Kernel::ConfigService;
+
+class PathLengthCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static PathLengthCacheTest *createSuite() { return new PathLengthCacheTest(); }
+  static void destroySuite(PathLengthCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_path = (std::filesystem::temp_directory_path() / "PathLengthCacheTest.pathlengths").string();
+  }
+
+  void tearDown() override { std::filesystem::remove(m_path); }
+
+  void test_saved_table_is_loaded() {
+    const PathLengthCache::Table table{{0.1, 0.2, 0.3}, {}, {1.5, 2.5, 3.5}};
+    TS_ASSERT(PathLengthCache::save(table, m_path));
+
+    const auto loaded = PathLengthCache::load(m_path, 3, 3);
+    TS_ASSERT(loaded);
+    TS_ASSERT_EQUALS(*loaded, table);
+  }
+
+  void test_table_of_a_different_size_is_ignored() {
+    TS_ASSERT(PathLengthCache::save({{0.1, 0.2}, {0.3, 0.4}}, m_path));
+    TS_ASSERT(!PathLengthCache::load(m_path, 3, 2));
+    TS_ASSERT(!PathLengthCache::load(m_path, 2, 3));
+  }
+
+  void test_missing_or_invalid_files_are_ignored() {
+    TS_ASSERT(!PathLengthCache::load(m_path, 1, 1));
+    std::ofstream(m_path) << "not a table";
+    TS_ASSERT(!PathLengthCache::load(m_path, 1, 1));
+  }
+
+  void test_filePath_is_empty_unless_enabled() {
+    auto &config = ConfigService::Instance();
+    const auto enabled = config.getString("absorptionCorrection.pathLengthCache");
+    config.setString("absorptionCorrection.pathLengthCache", "Off");
+    TS_ASSERT(PathLengthCache::filePath("0123abcd").empty());
+    config.setString("absorptionCorrection.pathLengthCache", "On");
+    TS_ASSERT_EQUALS(std::filesystem::path(PathLengthCache::filePath("0123abcd")).filename(), "0123abcd.pathlengths");
+    config.setString("absorptionCorrection.pathLengthCache", enabled);
+  }
+
+private:
+  std::string m_path;
+};
@@ -13,6 +13,7 @@
 #include <Eigen/StdVector>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -34,6 +35,9 @@ private:
   std::shared_ptr<const std::vector<std::pair<size_t, size_t>>> m_componentRanges;
   std::shared_ptr<const std::vector<size_t>> m_parentIndices;
   std::shared_ptr<std::vector<std::vector<size_t>>> m_children;
+  /// Positions and rotations of the non-detector components hold one
+  /// contiguous block of nonDetectorSize() entries per time index, see
+  /// linearIndex(). Detectors are stored in the same way by DetectorInfo.
   Mantid::Kernel::cow_ptr<std::vector<Eigen::Vector3d>> m_positions;
   Mantid::Kernel::cow_ptr<std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>> m_rotations;
   Mantid::Kernel::cow_ptr<std::vector<Eigen::Vector3d>> m_scaleFactors;
@@ -46,19 +50,14 @@ private:
   DetectorInfo *m_detectorInfo; // Geometry::DetectorInfo is the owner.
   /// The default initialisation is a single interval, i.e. no scan
   std::vector<std::pair<int64_t, int64_t>> m_scanIntervals{{0, 1}};
-  /// For (component index, time index) -> linear index conversions
-  Kernel::cow_ptr<std::vector<std::vector<size_t>>> m_indexMap{nullptr};
-  /// For linear index -> (detector index, time index) conversions
-  Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> m_indices{nullptr};
   void failIfDetectorInfoScanning() const;
   size_t linearIndex(const std::pair<size_t, size_t> &index) const;
   void initScanIntervals();
   void checkNoTimeDependence() const;
   std::vector<bool> buildMergeIndices(const ComponentInfo &other) const;
   void checkSizes(const ComponentInfo &other) const;
-  void initIndices();
-  void checkIdenticalIntervals(const ComponentInfo &other, const std::pair<size_t, size_t> &indexOther,
-                               const std::pair<size_t, size_t> &indexThis) const;
+  void checkIdenticalIntervals(const ComponentInfo &other, const size_t timeIndexOther,
+                               const size_t timeIndexThis) const;
   void checkSpecialIndices(size_t componentIndex) const;
   size_t nonDetectorSize() const;
   /// Copy constructor is private because of the way DetectorInfo stored
@@ -152,6 +151,16 @@ public:
   void setScanInterval(const std::pair<int64_t, int64_t> &interval);
   void merge(const ComponentInfo &other);
 
+  /// Read-only view of the scan interval and the positions and rotations of
+  /// the non-detector components at one time index, indexed by
+  /// compOffsetIndex(). Detectors are viewed with DetectorInfo::scanPoint().
+  struct ScanPoint {
+    std::pair<int64_t, int64_t> interval;
+    std::span<const Eigen::Vector3d> positions;
+    std::span<const Eigen::Quaterniond> rotations;
+  };
+  ScanPoint scanPoint(const size_t timeIndex) const;
+
   class Range {
   private:
     const std::vector<size_t>::const_iterator m_begin;
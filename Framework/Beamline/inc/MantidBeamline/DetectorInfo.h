@@ -12,6 +12,8 @@
 #include "Eigen/Geometry"
 #include "Eigen/StdVector"
 
+#include <span>
+
 namespace Mantid {
 namespace Beamline {
 
@@ -77,11 +79,20 @@ public:
   size_t scanCount() const;
   const std::vector<std::pair<int64_t, int64_t>> scanIntervals() const;
 
+  /// Read-only view of the positions and rotations of all detectors at one
+  /// time index, indexed by detector index.
+  struct ScanPoint {
+    std::span<const Eigen::Vector3d> positions;
+    std::span<const Eigen::Quaterniond> rotations;
+  };
+  ScanPoint scanPoint(const size_t timeIndex) const;
+
   void setComponentInfo(ComponentInfo *componentInfo);
   bool hasComponentInfo() const;
   double l1() const;
   const Eigen::Vector3d &sourcePosition() const;
   const Eigen::Vector3d &samplePosition() const;
+  size_t geometryVersion() const;
 
   /** The `merge()` operation was made private in `DetectorInfo`, and only
    * accessible through `ComponentInfo` (via this `friend` declaration)
@@ -101,13 +112,19 @@ private:
   void checkNoTimeDependence() const;
   void checkSizes(const DetectorInfo &other) const;
   void merge(const DetectorInfo &other, const std::vector<bool> &merge);
+  void updateGeometryVersion();
+  static size_t nextGeometryVersion();
 
   Kernel::cow_ptr<std::vector<bool>> m_isMonitor{nullptr};
   Kernel::cow_ptr<std::vector<bool>> m_isMasked{nullptr};
+  /// Masks, positions and rotations hold one contiguous block of size()
+  /// entries per time index, see linearIndex().
   Kernel::cow_ptr<std::vector<Eigen::Vector3d>> m_positions{nullptr};
   Kernel::cow_ptr<std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>> m_rotations{nullptr};
 
   ComponentInfo *m_componentInfo = nullptr; // Geometry::ComponentInfo owner
+  /// Identifies the current detector, source and sample positions
+  size_t m_geometryVersion{nextGeometryVersion()};
 };
 
 /** Returns the number of detectors in the instrument.
@@ -162,11 +179,13 @@ inline const Eigen::Quaterniond &DetectorInfo::rotation(const std::pair<size_t,
 inline void DetectorInfo::setPosition(const size_t index, const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  updateGeometryVersion();
 }
 
 /// Set the position of the detector with given index (scanning pair overload).
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index, const Eigen::Vector3d &position) {
   m_positions.access()[linearIndex(index)] = position;
+  updateGeometryVersion();
 }
 
 /** Set the rotation of the detector with given detector index.
@@ -176,11 +195,13 @@ inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index, co
 inline void DetectorInfo::setRotation(const size_t index, const Eigen::Quaterniond &rotation) {
   checkNoTimeDependence();
   m_rotations.access()[index] = rotation.normalized();
+  updateGeometryVersion();
 }
 
 /// Set the rotation of the detector with given index.
 inline void DetectorInfo::setRotation(const std::pair<size_t, size_t> &index, const Eigen::Quaterniond &rotation) {
   m_rotations.access()[linearIndex(index)] = rotation.normalized();
+  updateGeometryVersion();
 }
 
 /// Throws if this has time-dependent data.
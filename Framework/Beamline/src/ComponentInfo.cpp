@@ -271,6 +271,8 @@ void ComponentInfo::doSetPosition(const std::pair<size_t, size_t> &index, const
     size_t offsetIndex = compOffsetIndex(subIndex);
     m_positions.access()[offsetIndex] += offset;
   }
+  if (m_detectorInfo)
+    m_detectorInfo->updateGeometryVersion();
 }
 
 void ComponentInfo::doSetRotation(const std::pair<size_t, size_t> &index, const Eigen::Quaterniond &newRotation,
@@ -300,6 +302,8 @@ void ComponentInfo::doSetRotation(const std::pair<size_t, size_t> &index, const
     m_positions.access()[linearIndex({childCompIndexOffset, timeIndex})] = newPos;
     m_rotations.access()[linearIndex({childCompIndexOffset, timeIndex})] = newRot.normalized();
   }
+  if (m_detectorInfo)
+    m_detectorInfo->updateGeometryVersion();
 }
 
 void ComponentInfo::doScaleComponent(const std::pair<size_t, size_t> &index, const Eigen::Vector3d &newScaling,
@@ -320,6 +324,8 @@ void ComponentInfo::doScaleComponent(const std::pair<size_t, size_t> &index, con
     Eigen::Vector3d newPos = scalingMatrix * oldPos + (Eigen::Matrix3d::Identity() - scalingMatrix) * compPos;
     m_positions.access()[linearIndex({offsetIndex, timeIndex})] = std::move(newPos);
   }
+  if (m_detectorInfo)
+    m_detectorInfo->updateGeometryVersion();
 }
 
 /**
@@ -468,21 +474,6 @@ size_t ComponentInfo::linearIndex(const std::pair<size_t, size_t> &index) const
   return index.first + nNonDetectorComponents * index.second;
 }
 
-void ComponentInfo::initIndices() {
-  checkNoTimeDependence();
-  m_indexMap = Kernel::make_cow<std::vector<std::vector<size_t>>>();
-  m_indices = Kernel::make_cow<std::vector<std::pair<size_t, size_t>>>();
-  auto &indexMap = m_indexMap.access();
-  auto &indices = m_indices.access();
-  indexMap.reserve(nonDetectorSize());
-  indices.reserve(nonDetectorSize());
-  // No time dependence, so both the component index and the linear index are i.
-  for (size_t i = 0; i < nonDetectorSize(); ++i) {
-    indexMap.emplace_back(1, i);
-    indices.emplace_back(i, 0);
-  }
-}
-
 size_t ComponentInfo::parent(const size_t componentIndex) const { return (*m_parentIndices)[componentIndex]; }
 
 bool ComponentInfo::hasParent(const size_t componentIndex) const { return parent(componentIndex) != componentIndex; }
@@ -683,11 +674,17 @@ void ComponentInfo::merge(const ComponentInfo &other) {
   const auto &toMerge = buildMergeIndices(other);
   // Merging the detectorInfo has to be done before we update scanIntervals
   m_detectorInfo->merge(*other.m_detectorInfo, toMerge);
+  const auto mergedCount = static_cast<size_t>(std::count(toMerge.cbegin(), toMerge.cend(), true));
+  if (mergedCount == 0)
+    return;
+  auto &positions = m_positions.access();
+  auto &rotations = m_rotations.access();
+  m_scanIntervals.reserve(m_scanIntervals.size() + mergedCount);
+  positions.reserve(positions.size() + mergedCount * nonDetectorSize());
+  rotations.reserve(rotations.size() + mergedCount * nonDetectorSize());
   for (size_t timeIndex = 0; timeIndex < other.m_scanIntervals.size(); ++timeIndex) {
     if (!toMerge[timeIndex])
       continue;
-    auto &positions = m_positions.access();
-    auto &rotations = m_rotations.access();
     m_scanIntervals.emplace_back(other.m_scanIntervals[timeIndex]);
     const size_t indexStart = other.linearIndex({0, timeIndex});
     size_t indexEnd = indexStart + nonDetectorSize();
@@ -696,22 +693,37 @@ void ComponentInfo::merge(const ComponentInfo &other) {
   }
 }
 
+/** Decides which time indices of other are added by merge().
+ *
+ * The scan intervals of this never overlap, so once they are sorted by start
+ * time, the only one that can overlap an interval of other is the last one
+ * starting before that interval ends. This makes merging n scan points
+ * O(n log n) rather than O(n^2).
+ * @param other :: the ComponentInfo being merged into this
+ * @return a flag for each time index of other, true if it should be added
+ */
 std::vector<bool> ComponentInfo::buildMergeIndices(const ComponentInfo &other) const {
   checkSizes(other);
+  std::vector<size_t> sortedTimeIndices(m_scanIntervals.size());
+  std::iota(sortedTimeIndices.begin(), sortedTimeIndices.end(), size_t{0});
+  std::sort(sortedTimeIndices.begin(), sortedTimeIndices.end(),
+            [this](const size_t a, const size_t b) { return m_scanIntervals[a].first < m_scanIntervals[b].first; });
+
   std::vector<bool> mergeIndices(other.m_scanIntervals.size(), true);
   for (size_t t1 = 0; t1 < other.m_scanIntervals.size(); ++t1) {
-    for (size_t t2 = 0; t2 < m_scanIntervals.size(); ++t2) {
-      const auto interval1 = other.m_scanIntervals[t1];
-      const auto interval2 = m_scanIntervals[t2];
-      if (interval1 == interval2) {
-        for (size_t compIndex = 0u; compIndex < size(); ++compIndex) {
-          checkIdenticalIntervals(other, std::pair<size_t, size_t>(compIndex, t1),
-                                  std::pair<size_t, size_t>(compIndex, t2));
-        }
-        mergeIndices[t1] = false;
-      } else if ((interval1.first < interval2.second) && (interval1.second > interval2.first)) {
-        failMerge("scan intervals overlap but not identical");
-      }
+    const auto &interval1 = other.m_scanIntervals[t1];
+    const auto next = std::lower_bound(
+        sortedTimeIndices.cbegin(), sortedTimeIndices.cend(), interval1.second,
+        [this](const size_t timeIndex, const int64_t end) { return m_scanIntervals[timeIndex].first < end; });
+    if (next == sortedTimeIndices.cbegin())
+      continue;
+    const auto t2 = *std::prev(next);
+    const auto &interval2 = m_scanIntervals[t2];
+    if (interval1 == interval2) {
+      checkIdenticalIntervals(other, t1, t2);
+      mergeIndices[t1] = false;
+    } else if (interval2.second > interval1.first) {
+      failMerge("scan intervals overlap but not identical");
     }
   }
   return mergeIndices;
@@ -722,12 +734,37 @@ void ComponentInfo::checkSizes(const ComponentInfo &other) const {
     failMerge("size mismatch");
 }
 
-void ComponentInfo::checkIdenticalIntervals(const ComponentInfo &other, const std::pair<size_t, size_t> &indexOther,
-                                            const std::pair<size_t, size_t> &indexThis) const {
-  if (this->position(indexThis) != other.position(indexOther))
-    failMerge("matching scan interval but positions differ");
-  if (this->rotation(indexThis).coeffs() != other.rotation(indexOther).coeffs())
-    failMerge("matching scan interval but rotations differ");
+void ComponentInfo::checkIdenticalIntervals(const ComponentInfo &other, const size_t timeIndexOther,
+                                            const size_t timeIndexThis) const {
+  const auto check = [](const auto &pointThis, const auto &pointOther) {
+    for (size_t i = 0; i < pointThis.positions.size(); ++i) {
+      if (pointThis.positions[i] != pointOther.positions[i])
+        failMerge("matching scan interval but positions differ");
+      if (pointThis.rotations[i].coeffs() != pointOther.rotations[i].coeffs())
+        failMerge("matching scan interval but rotations differ");
+    }
+  };
+  // Detectors come first in the component indices
+  check(m_detectorInfo->scanPoint(timeIndexThis), other.m_detectorInfo->scanPoint(timeIndexOther));
+  check(scanPoint(timeIndexThis), other.scanPoint(timeIndexOther));
+}
+
+/** Returns a view of the scan interval and of the positions and rotations of
+ * the non-detector components at a time index. Each time index is stored as
+ * one contiguous block, so nothing is copied. The view is invalidated by any
+ * modification of this ComponentInfo.
+ * @param timeIndex :: the index of the scan point
+ * @return the interval, positions and rotations for the time index
+ */
+ComponentInfo::ScanPoint ComponentInfo::scanPoint(const size_t timeIndex) const {
+  if (timeIndex >= scanCount())
+    throw std::out_of_range("ComponentInfo: time index " + std::to_string(timeIndex) + " is out of range");
+  if (nonDetectorSize() == 0)
+    return {m_scanIntervals[timeIndex], {}, {}};
+  const auto start = linearIndex({0, timeIndex});
+  return {m_scanIntervals[timeIndex],
+          {m_positions->data() + start, nonDetectorSize()},
+          {m_rotations->data() + start, nonDetectorSize()}};
 }
 
 /**
@@ -786,12 +823,6 @@ size_t ComponentInfo::getMemorySize() const {
   // m_scanIntervals: inline vector's heap buffer
   mem += m_scanIntervals.capacity() * sizeof(std::pair<int64_t, int64_t>);
 
-  // Scanning index structures (null for non-scanning instruments)
-  if (m_indexMap)
-    mem += sizeof(*m_indexMap) + m_indexMap->size() * sizeof(std::vector<size_t>);
-  if (m_indices)
-    mem += sizeof(*m_indices) + m_indices->size() * sizeof(std::pair<size_t, size_t>);
-
   return mem;
 }
 
@@ -9,7 +9,10 @@
 #include "MantidKernel/make_cow.h"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
+#include <stdexcept>
+#include <string>
 
 namespace Mantid::Beamline {
 
@@ -55,8 +58,7 @@ bool DetectorInfo::isEquivalent(const DetectorInfo &other) const {
   if (!(m_isMasked == other.m_isMasked) && (*m_isMasked != *other.m_isMasked))
     return false;
 
-  // Scanning related fields. Not testing m_indexMap since
-  // those just are internally derived from m_indices.
+  // Scanning related fields.
   if (this->hasComponentInfo() && (this->scanIntervals() != other.scanIntervals()))
     return false;
 
@@ -174,24 +176,65 @@ void failMerge(const std::string &what) { throw std::runtime_error(std::string("
  */
 void DetectorInfo::merge(const DetectorInfo &other, const std::vector<bool> &merge) {
   checkSizes(other);
+  const auto mergedCount = static_cast<size_t>(std::count(merge.cbegin(), merge.cend(), true));
+  if (mergedCount == 0)
+    return;
+  auto &isMaskedVec = m_isMasked.access();
+  auto &positions = m_positions.access();
+  auto &rotations = m_rotations.access();
+  isMaskedVec.reserve(isMaskedVec.size() + mergedCount * size());
+  positions.reserve(positions.size() + mergedCount * size());
+  rotations.reserve(rotations.size() + mergedCount * size());
   for (size_t timeIndex = 0; timeIndex < other.scanCount(); ++timeIndex) {
     if (!merge[timeIndex])
       continue;
-    auto &isMaskedVec = m_isMasked.access();
-    auto &positions = m_positions.access();
-    auto &rotations = m_rotations.access();
     const size_t indexStart = other.linearIndex({0, timeIndex});
     size_t indexEnd = indexStart + size();
     isMaskedVec.insert(isMaskedVec.end(), other.m_isMasked->begin() + indexStart, other.m_isMasked->begin() + indexEnd);
     positions.insert(positions.end(), other.m_positions->begin() + indexStart, other.m_positions->begin() + indexEnd);
     rotations.insert(rotations.end(), other.m_rotations->begin() + indexStart, other.m_rotations->begin() + indexEnd);
   }
+  updateGeometryVersion();
 }
 
 void DetectorInfo::setComponentInfo(ComponentInfo *componentInfo) { m_componentInfo = componentInfo; }
 
 bool DetectorInfo::hasComponentInfo() const { return m_componentInfo != nullptr; }
 
+/** Returns a view of the positions and rotations of all detectors at a time
+ * index. Each time index is stored as one contiguous block, so nothing is
+ * copied. The view is invalidated by any modification of this DetectorInfo.
+ * @param timeIndex :: the index of the scan point
+ * @return the positions and rotations indexed by detector index
+ */
+DetectorInfo::ScanPoint DetectorInfo::scanPoint(const size_t timeIndex) const {
+  // Without a ComponentInfo there is no scan and only time index 0 exists
+  if (timeIndex >= (hasComponentInfo() ? scanCount() : 1))
+    throw std::out_of_range("DetectorInfo: time index " + std::to_string(timeIndex) + " is out of range");
+  if (size() == 0)
+    return {};
+  const auto start = linearIndex({0, timeIndex});
+  return {{m_positions->data() + start, size()}, {m_rotations->data() + start, size()}};
+}
+
+/** Returns a number identifying the current positions and rotations of the
+ * detectors and of the source and sample.
+ *
+ * The number changes whenever any of them are modified, so it can be used to
+ * tell if values derived from the geometry need to be recomputed. Copies
+ * share the number of the DetectorInfo they were copied from.
+ */
+size_t DetectorInfo::geometryVersion() const { return m_geometryVersion; }
+
+/// Gives this a new geometry version after a change of positions or rotations.
+void DetectorInfo::updateGeometryVersion() { m_geometryVersion = nextGeometryVersion(); }
+
+/// Returns a geometry version that has not been used by any DetectorInfo.
+size_t DetectorInfo::nextGeometryVersion() {
+  static std::atomic<size_t> version{0};
+  return version.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 double DetectorInfo::l1() const {
   // TODO Not scan safe yet for scanning ComponentInfo
   if (!hasComponentInfo()) {
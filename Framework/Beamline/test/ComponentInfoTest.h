@@ -988,6 +988,36 @@ public:
                             "overlap but not identical");
   }
 
+  void test_merge_scan_points_in_any_order() {
+    const auto makeScanPoint = [](const int64_t start) {
+      auto infos = makeFlatTree(PosVec(1, Eigen::Vector3d(static_cast<double>(start), 0, 0)),
+                                RotVec(1, Eigen::Quaterniond::Identity()));
+      std::get<0>(infos)->setScanInterval({start, start + 10});
+      return infos;
+    };
+    auto infos = makeScanPoint(20);
+    ComponentInfo &a = *std::get<0>(infos);
+    for (const int64_t start : {0, 40, 10, 30})
+      a.merge(*std::get<0>(makeScanPoint(start)));
+    TS_ASSERT_EQUALS(a.scanCount(), 5);
+
+    // Identical scan points are not added again
+    a.merge(*std::get<0>(makeScanPoint(10)));
+    TS_ASSERT_EQUALS(a.scanCount(), 5);
+    TS_ASSERT_THROWS_EQUALS(a.merge(*std::get<0>(makeScanPoint(5))), const std::runtime_error &e,
+                            std::string(e.what()),
+                            "Cannot merge ComponentInfo: scan intervals "
+                            "overlap but not identical");
+
+    // Time indices are in the order of merging
+    const auto scanPoint = a.scanPoint(2);
+    TS_ASSERT_EQUALS(scanPoint.interval, (std::pair<int64_t, int64_t>(40, 50)));
+    TS_ASSERT_EQUALS(scanPoint.positions.size(), 1);
+    TS_ASSERT_EQUALS(scanPoint.positions[0], Eigen::Vector3d(0, 0, 0));
+    TS_ASSERT_EQUALS(std::get<1>(infos)->scanPoint(2).positions[0], Eigen::Vector3d(40, 0, 0));
+    TS_ASSERT_THROWS(a.scanPoint(5), const std::out_of_range &);
+  }
+
   void test_merge_detectors() {
     auto infos1 = makeFlatTree(PosVec(1), RotVec(1));
     auto infos2 = makeFlatTree(PosVec(1), RotVec(1));
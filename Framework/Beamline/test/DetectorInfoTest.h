@@ -264,6 +264,40 @@ public:
     TS_ASSERT_EQUALS(info.rotation(0).coeffs(), rot.normalized().coeffs());
   }
 
+  void test_scanPoint() {
+    DetectorInfo info(PosVec(2, Eigen::Vector3d(1, 2, 3)), RotVec(2, Eigen::Quaterniond::Identity()));
+    info.setPosition(1, {4, 5, 6});
+    const auto scanPoint = info.scanPoint(0);
+    TS_ASSERT_EQUALS(scanPoint.positions.size(), 2);
+    TS_ASSERT_EQUALS(scanPoint.rotations.size(), 2);
+    TS_ASSERT_EQUALS(scanPoint.positions[0], Eigen::Vector3d(1, 2, 3));
+    TS_ASSERT_EQUALS(scanPoint.positions[1], Eigen::Vector3d(4, 5, 6));
+    TS_ASSERT_EQUALS(scanPoint.rotations[1].coeffs(), Eigen::Quaterniond::Identity().coeffs());
+    TS_ASSERT_THROWS(info.scanPoint(1), const std::out_of_range &);
+  }
+
+  void test_scanPoint_checks_time_index_without_detectors() {
+    DetectorInfo info(PosVec(0), RotVec(0));
+    TS_ASSERT_EQUALS(info.scanPoint(0).positions.size(), 0);
+    TS_ASSERT_THROWS(info.scanPoint(1), const std::out_of_range &);
+  }
+
+  void test_geometryVersion() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    const DetectorInfo other(PosVec(1), RotVec(1));
+    TS_ASSERT_DIFFERS(info.geometryVersion(), other.geometryVersion());
+    const auto version = info.geometryVersion();
+    info.setMasked(0, true);
+    TS_ASSERT_EQUALS(info.geometryVersion(), version);
+    info.setPosition(0, {1, 2, 3});
+    const auto moved = info.geometryVersion();
+    TS_ASSERT_DIFFERS(moved, version);
+    info.setRotation(0, Eigen::Quaterniond{1, 2, 3, 4});
+    TS_ASSERT_DIFFERS(info.geometryVersion(), moved);
+    const DetectorInfo copy(info);
+    TS_ASSERT_EQUALS(copy.geometryVersion(), info.geometryVersion());
+  }
+
   void test_scanCount() {
     DetectorInfo detInfo;
     Mantid::Beamline::ComponentInfo compInfo;
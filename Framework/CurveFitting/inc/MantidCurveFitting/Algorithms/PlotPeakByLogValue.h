@@ -69,15 +69,15 @@ private:
   std::shared_ptr<Algorithm> runSingleFit(bool createFitOutput, bool outputCompositeMembers,
                                           bool outputConvolvedMembers, bool appendIdx, const API::IFunction_sptr &ifun,
                                           const InputSpectraToFit &data, double startX, double endX,
-                                          const std::string &exclude);
+                                          const std::string &exclude, const std::string &minimizer);
 
   double calculateLogValue(const std::string &logName, const InputSpectraToFit &data);
 
   API::ITableWorkspace_sptr createResultsTable(const std::string &logName, const API::IFunction_sptr &ifunSingle,
                                                bool &isDataName);
 
-  void appendTableRow(bool isDataName, API::ITableWorkspace_sptr &result, const API::IFunction_sptr &ifun,
-                      const InputSpectraToFit &data, double logValue, double chi2) const;
+  void setTableRow(bool isDataName, API::ITableWorkspace &result, size_t rowIndex, const API::IFunction_sptr &ifun,
+                   const InputSpectraToFit &data, double logValue, double chi2) const;
 
   void finaliseOutputWorkspacesWithAppend(const std::vector<std::string> &fitWorkspaces,
                                           const std::vector<std::string> &parameterWorkspaces,
@@ -108,6 +108,9 @@ private:
 
   /// Record of workspaces output by the minimizer
   std::map<std::string, std::vector<std::string>> m_minimizerWorkspaces;
+
+  /// Whether all of the minimizers created can run at the same time
+  bool m_minimizersRunConcurrently{true};
 };
 
 } // namespace Algorithms
@@ -0,0 +1,163 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/IFunction.h"
+#include "MantidAPI/Jacobian.h"
+
+#include <array>
+#include <cmath>
+
+namespace Mantid {
+namespace CurveFitting {
+/**
+Forward-mode automatic differentiation for fitting functions.
+
+A function whose formula is written as a template of its value type can be
+evaluated with Dual numbers in place of doubles. Every Dual carries the
+derivatives of its value with respect to the fitting parameters, so a single
+pass gives the values and the exact derivatives, which is cheaper and more
+accurate than the numerical derivatives IFunction calculates otherwise.
+
+A typical functionDeriv1D is
+
+  const auto p = AutoDiff::parameters<3>(*this);
+  for (size_t i = 0; i < nData; ++i)
+    AutoDiff::setDerivatives(*jacobian, i, formula(xValues[i], p[0], p[1], p[2]));
+*/
+namespace AutoDiff {
+
+/// A value together with its derivatives with respect to N variables
+template <size_t N> class Dual {
+public:
+  /// A constant, whose derivatives are all zero
+  Dual(const double value = 0.0) : m_value(value), m_derivatives{} {}
+
+  /// The variable with the given index
+  static Dual variable(const double value, const size_t index) {
+    Dual result(value);
+    result.m_derivatives[index] = 1.0;
+    return result;
+  }
+
+  double value() const { return m_value; }
+  double derivative(const size_t index) const { return m_derivatives[index]; }
+
+  /**
+   * Apply a function of one variable using the chain rule.
+   * @param value :: the value of the function at this number
+   * @param slope :: the derivative of the function at this number
+   * @return the result with its derivatives
+   */
+  Dual chain(const double value, const double slope) const {
+    Dual result(value);
+    for (size_t i = 0; i < N; ++i)
+      result.m_derivatives[i] = slope * m_derivatives[i];
+    return result;
+  }
+
+  Dual operator-() const { return chain(-m_value, -1.0); }
+
+  Dual &operator+=(const Dual &rhs) {
+    m_value += rhs.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] += rhs.m_derivatives[i];
+    return *this;
+  }
+  Dual &operator-=(const Dual &rhs) {
+    m_value -= rhs.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] -= rhs.m_derivatives[i];
+    return *this;
+  }
+  Dual &operator*=(const Dual &rhs) {
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] = m_derivatives[i] * rhs.m_value + m_value * rhs.m_derivatives[i];
+    m_value *= rhs.m_value;
+    return *this;
+  }
+  Dual &operator/=(const Dual &rhs) {
+    m_value /= rhs.m_value;
+    for (size_t i = 0; i < N; ++i)
+      m_derivatives[i] = (m_derivatives[i] - m_value * rhs.m_derivatives[i]) / rhs.m_value;
+    return *this;
+  }
+
+  // Defined here so that doubles convert implicitly on either side
+  friend Dual operator+(Dual lhs, const Dual &rhs) { return lhs += rhs; }
+  friend Dual operator-(Dual lhs, const Dual &rhs) { return lhs -= rhs; }
+  friend Dual operator*(Dual lhs, const Dual &rhs) { return lhs *= rhs; }
+  friend Dual operator/(Dual lhs, const Dual &rhs) { return lhs /= rhs; }
+  friend bool operator<(const Dual &lhs, const Dual &rhs) { return lhs.m_value < rhs.m_value; }
+  friend bool operator>(const Dual &lhs, const Dual &rhs) { return lhs.m_value > rhs.m_value; }
+
+  friend Dual exp(const Dual &x) {
+    const double value = std::exp(x.m_value);
+    return x.chain(value, value);
+  }
+  friend Dual log(const Dual &x) { return x.chain(std::log(x.m_value), 1.0 / x.m_value); }
+  friend Dual sqrt(const Dual &x) {
+    const double value = std::sqrt(x.m_value);
+    return x.chain(value, 0.5 / value);
+  }
+  friend Dual sin(const Dual &x) { return x.chain(std::sin(x.m_value), std::cos(x.m_value)); }
+  friend Dual cos(const Dual &x) { return x.chain(std::cos(x.m_value), -std::sin(x.m_value)); }
+  friend Dual fabs(const Dual &x) { return x.m_value < 0.0 ? -x : x; }
+  friend Dual erfc(const Dual &x) {
+    return x.chain(std::erfc(x.m_value), -M_2_SQRTPI * std::exp(-x.m_value * x.m_value));
+  }
+  friend Dual pow(const Dual &x, const double exponent) {
+    const double value = std::pow(x.m_value, exponent);
+    Dual result(value);
+    const double slope = exponent * std::pow(x.m_value, exponent - 1.0);
+    // x^a can have an infinite slope at x = 0, which must not turn the
+    // derivatives of a constant x into NaN
+    for (size_t i = 0; i < N; ++i)
+      result.m_derivatives[i] = x.m_derivatives[i] == 0.0 ? 0.0 : slope * x.m_derivatives[i];
+    return result;
+  }
+  friend Dual pow(const Dual &x, const Dual &exponent) {
+    Dual result = pow(x, exponent.m_value);
+    // d(x^a)/da = x^a ln(x), which tends to 0 as x tends to 0
+    const double slope = x.m_value > 0.0 ? result.m_value * std::log(x.m_value) : 0.0;
+    for (size_t i = 0; i < N; ++i)
+      result.m_derivatives[i] += slope * exponent.m_derivatives[i];
+    return result;
+  }
+
+private:
+  double m_value;
+  std::array<double, N> m_derivatives;
+};
+
+/**
+ * Create the variables for the parameters of a function.
+ * @param function :: a function with N declared parameters
+ * @return a Dual for each parameter, whose derivatives are those with respect
+ * to the parameter of the same index
+ */
+template <size_t N> std::array<Dual<N>, N> parameters(const API::IFunction &function) {
+  std::array<Dual<N>, N> variables;
+  for (size_t i = 0; i < N; ++i)
+    variables[i] = Dual<N>::variable(function.getParameter(i), i);
+  return variables;
+}
+
+/**
+ * Store the derivatives of a value with respect to every parameter.
+ * @param jacobian :: the Jacobian to fill
+ * @param iY :: the index of the data point
+ * @param value :: the value of the function at the data point
+ */
+template <size_t N> void setDerivatives(API::Jacobian &jacobian, const size_t iY, const Dual<N> &value) {
+  for (size_t i = 0; i < N; ++i)
+    jacobian.set(iY, i, value.derivative(i));
+}
+
+} // namespace AutoDiff
+} // namespace CurveFitting
+} // namespace Mantid
@@ -32,6 +32,13 @@ public:
   /// Get short name of minimizer - useful for say labels in guis
   std::string shortName() const override { return "Chi-sq"; };
 
+  /// Keep the values of the members of a composite fitting function and only
+  /// recalculate those whose parameters changed
+  void setReuseMemberValues(bool reuse);
+  /// Set fitting function, domain and values, dropping any kept member values
+  void setFittingFunction(API::IFunction_sptr function, API::FunctionDomain_sptr domain,
+                          API::FunctionValues_sptr values) override;
+
 protected:
   void calActiveCovarianceMatrix(EigenMatrix &covar, double epsrel = 1e-8) override;
 
@@ -46,6 +53,20 @@ protected:
   virtual void updateValidateFitWeights() override;
 
   double m_factor;
+
+private:
+  void calculateByMembers(const API::FunctionDomain &domain, API::FunctionValues &values) const;
+
+  /// The values of a member of a composite function and the parameters they
+  /// were calculated with
+  struct MemberValues {
+    API::IFunction_sptr function;
+    std::vector<double> parameters;
+    std::vector<double> calculated;
+  };
+  /// Whether to keep the values of composite members between evaluations
+  bool m_reuseMemberValues;
+  mutable std::vector<MemberValues> m_memberValues;
 };
 
 } // namespace CostFunctions
@@ -12,6 +12,8 @@
 #include "MantidCurveFitting/EigenMatrix.h"
 #include "MantidCurveFitting/EigenVector.h"
 
+#include <random>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace CostFunctions {
@@ -35,6 +37,8 @@ public:
   FABADAMinimizer();
   /// Name of the minimizer.
   std::string name() const override { return "FABADA"; }
+  /// The PDFs of all fits are collected in one group, in the order of the fits
+  bool canRunConcurrently() const override { return false; }
   /// Initialize minimizer, i.e. pass a function to minimize.
   void initialize(API::ICostFunction_sptr function, size_t maxIterations) override;
   /// Do one iteration.
@@ -68,10 +72,14 @@ private:
   void simAnnealingRefrigeration();
   /// Decides wheather iteration must continue or not
   bool iterationContinuation();
+  /// Add a point to the Markov chain
+  void appendToChain(const EigenVector &parameters, double chi2);
+  /// A point of the converged chain, thinned to one in StepsBetweenValues
+  double convergedChainValue(size_t parameterIndex, size_t k) const;
   /// Output Markov chains
   void outputChains();
   /// Output converged chains
-  void outputConvergedChains(size_t convLength, int nSteps);
+  void outputConvergedChains(size_t convLength);
   /// Output cost function
   void outputCostFunctionTable(size_t convLength, double mostProbableChi2);
   /// Output PDF
@@ -91,8 +99,7 @@ private:
   void outputParameterTable(const std::vector<double> &bestParameters, const std::vector<double> &errorsLeft,
                             const std::vector<double> &errorsRight);
   /// Calculated converged chain and parameters
-  void calculateConvChainAndBestParameters(size_t convLength, int nSteps,
-                                           std::vector<std::vector<double>> &reducedChain,
+  void calculateConvChainAndBestParameters(size_t convLength, std::vector<std::vector<double>> &reducedChain,
                                            std::vector<double> &bestParameters, std::vector<double> &errorLeft,
                                            std::vector<double> &errorRight);
   /// Initialize member variables related to fitting parameters
@@ -117,8 +124,15 @@ private:
   std::vector<double> m_jump;
   /// Parameters' values.
   EigenVector m_parameters;
-  /// Markov chain.
+  /// Markov chain. Unless the complete chain is output, only the thinned
+  /// converged part is stored.
   std::vector<std::vector<double>> m_chain;
+  /// Whether the complete chain is stored
+  bool m_storeFullChain;
+  /// Number of points added to the chain, stored or not
+  size_t m_chainSize;
+  /// Steps done between the points of the converged chain
+  size_t m_stepsBetweenValues;
   /// The chi square result of previous iteration;
   double m_chi2;
   /// Boolean that indicates global convergence
@@ -152,6 +166,8 @@ private:
   std::vector<size_t> m_numInactiveRegenerations;
   /// To track convergence through immobility
   std::vector<int> m_changesOld;
+  /// Random number generator of the steps, seeded at initialization
+  std::mt19937 m_randomGenerator;
 };
 
 /// Used to access the setDirty() protected member
@@ -28,6 +28,7 @@ class MANTID_CURVEFITTING_DLL Abragam : public API::ParamFunction, public API::I
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "Abragam"; }
+  bool threadSafe() const override { return true; }
 
   /// overwrite IFunction base class methods
   const std::string category() const override { return "Muon\\MuonSpecific"; }
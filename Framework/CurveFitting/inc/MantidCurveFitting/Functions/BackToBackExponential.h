@@ -54,6 +54,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "BackToBackExponential"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Peak"; }
   void function1D(double *out, const double *xValues, const size_t nData) const override;
   void functionDeriv1D(API::Jacobian *jacobian, const double *xValues, const size_t nData) override;
@@ -117,8 +117,7 @@ public:
   /// Set up the function for a fit.
   void setUpForFit() override;
 
-  /// Deletes and zeroes pointer m_resolution forsing function(...) to
-  /// recalculate the resolution function
+  /// Deletes the cached resolution forcing function(...) to recalculate it
   void refreshResolution() const;
 
 protected:
@@ -130,7 +129,18 @@ private:
   /// step in xValues) when in FFT mode, and the inverted resolution if in
   /// Direct mode
   mutable std::vector<double> m_resolution;
+  /// The resolution evaluated on the domain, for delta functions in the model
+  mutable std::vector<double> m_resolutionOnDomain;
+  /// The mode, the domain and the resolution parameters m_resolution was
+  /// calculated for
+  mutable std::vector<double> m_resolutionKey;
+  struct FFTWorkspace;
+  /// The GSL workspace and wavetables for the size of the last domain
+  mutable std::shared_ptr<FFTWorkspace> m_fftWorkspace;
   void innerFunctionsAre1D() const;
+  bool resolutionIsCurrent(const double *xValues, const size_t nData, const bool fftMode) const;
+  const std::vector<double> &resolutionOnDomain(const double *xValues, const size_t nData) const;
+  FFTWorkspace &fftWorkspace(const size_t nData) const;
 };
 
 } // namespace Functions
@@ -41,6 +41,7 @@ public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "CriticalPeakRelaxationRate"; }
   void function1D(double *out, const double *xValues, const size_t nData) const override;
+  void functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) override;
   const std::string category() const override { return "Muon\\MuonModelling\\Magnetism"; }
 
 protected:
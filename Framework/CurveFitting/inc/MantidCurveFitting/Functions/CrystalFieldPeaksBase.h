@@ -11,6 +11,8 @@
 #include "MantidCurveFitting/DllConfig.h"
 #include "MantidCurveFitting/EigenFortranDefs.h"
 
+#include <vector>
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
@@ -36,6 +38,18 @@ protected:
   /// Store the default domain size after first
   /// function evaluation
   mutable size_t m_defaultDomainSize;
+
+private:
+  /// An eigensystem and the ion and field it was calculated for
+  struct EigenSystem {
+    std::vector<double> key;
+    DoubleFortranVector energies;
+    ComplexFortranMatrix waveFunctions;
+    ComplexFortranMatrix hamiltonian;
+    ComplexFortranMatrix hamiltonianZeeman;
+  };
+  /// The most recently calculated eigensystems, the latest first
+  mutable std::vector<EigenSystem> m_eigenSystems;
 };
 
 class MANTID_CURVEFITTING_DLL CrystalFieldPeaksBaseImpl : public CrystalFieldPeaksBase {
@@ -38,6 +38,7 @@ public:
   virtual double HeightPrefactor() const { return 1.0; } // modulates the Height of the Delta function
   /// overwrite IFunction base class methods
   std::string name() const override { return "DeltaFunction"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Peak"; }
 
 protected:
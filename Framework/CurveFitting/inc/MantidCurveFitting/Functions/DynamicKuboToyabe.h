@@ -14,6 +14,7 @@
 #include "MantidAPI/IPeakFunction.h"
 #include "MantidCurveFitting/DllConfig.h"
 #include <cmath>
+#include <vector>
 
 namespace Mantid {
 namespace CurveFitting {
@@ -33,6 +34,7 @@ public:
 
   /// overwrite base class methods
   std::string name() const override { return "DynamicKuboToyabe"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Muon\\MuonGeneric"; }
 
   /// Set a value to attribute attName
@@ -52,6 +54,10 @@ private:
   /// Bin width
   double m_eps;
   double m_minEps, m_maxEps;
+  /// Parameters the cached tables below were computed for
+  mutable double m_oldG, m_oldV, m_oldF, m_oldEps;
+  /// Cached static and dynamic Kubo-Toyabe tables
+  mutable std::vector<double> m_gStat, m_gDyn;
 };
 
 } // namespace Functions
@@ -27,6 +27,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "ElasticDiffSphere"; }
+  bool threadSafe() const override { return true; }
 
   const std::string category() const override { return "QuasiElastic"; }
 
@@ -26,6 +26,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "ElasticIsoRotDiff"; }
+  bool threadSafe() const override { return true; }
 
   const std::string category() const override { return "QuasiElastic"; }
 
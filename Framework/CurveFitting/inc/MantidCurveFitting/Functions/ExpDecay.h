@@ -29,6 +29,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "ExpDecay"; }
+  bool threadSafe() const override { return true; }
 
   /// overwrite IFunction base class methods
   const std::string category() const override { return "General"; }
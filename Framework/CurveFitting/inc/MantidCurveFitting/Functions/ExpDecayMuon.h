@@ -27,6 +27,7 @@ class MANTID_CURVEFITTING_DLL ExpDecayMuon : public API::ParamFunction, public A
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "ExpDecayMuon"; }
+  bool threadSafe() const override { return true; }
 
   /// overwrite IFunction base class methods
   const std::string category() const override { return "Muon\\MuonGeneric"; }
@@ -28,6 +28,7 @@ class MANTID_CURVEFITTING_DLL ExpDecayOsc : public API::ParamFunction, public AP
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "ExpDecayOsc"; }
+  bool threadSafe() const override { return true; }
 
   /// overwrite IFunction base class methods
   const std::string category() const override { return "Muon\\MuonGeneric"; }
@@ -20,6 +20,7 @@ namespace Functions {
 class MANTID_CURVEFITTING_DLL FlatBackground : public BackgroundFunction {
 public:
   std::string name() const override;
+  bool threadSafe() const override { return true; }
   void function1D(double *out, const double *xValues, const size_t nData) const override;
   void functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) override;
 
@@ -55,6 +55,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "Gaussian"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Peak; Muon\\MuonModelling"; }
   void setActiveParameter(size_t i, double value) override;
   double activeParameter(size_t i) const override;
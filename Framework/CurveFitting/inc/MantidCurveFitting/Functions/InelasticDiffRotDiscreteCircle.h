@@ -26,6 +26,7 @@ public:
   InelasticDiffRotDiscreteCircle();
 
   std::string name() const override { return "InelasticDiffRotDiscreteCircle"; }
+  bool threadSafe() const override { return true; }
 
   const std::string category() const override { return "QuasiElastic"; }
 
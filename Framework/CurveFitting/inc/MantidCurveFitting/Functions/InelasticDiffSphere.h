@@ -45,6 +45,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "InelasticDiffSphere"; }
+  bool threadSafe() const override { return true; }
 
   /// overwrite IFunction base class methods
   const std::string category() const override { return "QuasiElastic"; }
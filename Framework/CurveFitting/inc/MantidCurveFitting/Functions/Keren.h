@@ -24,6 +24,7 @@ class MANTID_CURVEFITTING_DLL Keren : public API::ParamFunction, public API::IFu
 public:
   /// Name of function
   std::string name() const override { return "Keren"; }
+  bool threadSafe() const override { return true; }
   /// Category for function
   const std::string category() const override { return "Muon\\MuonSpecific"; }
   /// Set active parameter
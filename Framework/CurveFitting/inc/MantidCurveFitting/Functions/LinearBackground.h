@@ -31,6 +31,7 @@ class MANTID_CURVEFITTING_DLL LinearBackground : public BackgroundFunction {
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "LinearBackground"; }
+  bool threadSafe() const override { return true; }
   void function1D(double *out, const double *xValues, const size_t nData) const override;
   void functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) override;
 
@@ -49,6 +49,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "Lorentzian"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Peak; Muon\\MuonModelling"; }
 
 protected:
@@ -27,6 +27,7 @@ class MANTID_CURVEFITTING_DLL MuonFInteraction : public API::ParamFunction, publ
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "MuonFInteraction"; }
+  bool threadSafe() const override { return true; }
 
   /// overwrite IFunction base class methods
   const std::string category() const override { return "Muon\\MuonSpecific"; }
@@ -22,6 +22,7 @@ public:
 
   /// Overwrite IFunction base class
   std::string name() const override { return "Polynomial"; }
+  bool threadSafe() const override { return true; }
 
   const std::string category() const override { return "Background; Muon\\MuonModelling"; }
 
@@ -46,6 +46,7 @@ public:
   void setIntensity(const double newIntensity) override { setParameter("Intensity", newIntensity); }
 
   std::string name() const override { return "PseudoVoigt"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Peak"; }
 
   /// Set i-th parameter
@@ -32,6 +32,7 @@ class MANTID_CURVEFITTING_DLL Quadratic : public BackgroundFunction {
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "Quadratic"; }
+  bool threadSafe() const override { return true; }
   void function1D(double *out, const double *xValues, const size_t nData) const override;
   void functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) override;
 
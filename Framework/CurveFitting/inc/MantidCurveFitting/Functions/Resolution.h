@@ -31,6 +31,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "Resolution"; }
+  bool threadSafe() const override { return true; }
   /// Function values
   void function1D(double *out, const double *xValues, const size_t nData) const override;
   ///  function derivatives
@@ -29,6 +29,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "StretchExp"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "General"; }
 
 protected:
@@ -25,10 +25,12 @@ class MANTID_CURVEFITTING_DLL StretchExpMuon : public API::ParamFunction, public
 public:
   /// overwrite IFunction base class methods
   std::string name() const override { return "StretchExpMuon"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "Muon\\MuonGeneric"; }
 
 protected:
   void function1D(double *out, const double *xValues, const size_t nData) const override;
+  void functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) override;
   void init() override;
 };
 
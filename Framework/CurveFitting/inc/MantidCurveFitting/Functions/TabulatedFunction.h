@@ -59,6 +59,7 @@ public:
 
   /// overwrite IFunction base class methods
   std::string name() const override { return "TabulatedFunction"; }
+  bool threadSafe() const override { return true; }
   const std::string category() const override { return "General"; }
   void function1D(double *out, const double *xValues, const size_t nData) const override;
   ///  function derivatives
@@ -18,12 +18,22 @@ namespace mu {
 class Parser;
 }
 
+namespace Mantid {
+namespace API {
+class CompiledFormula;
+}
+} // namespace Mantid
+
 namespace Mantid {
 namespace CurveFitting {
 namespace Functions {
 /**
 A user defined function.
 
+Formulas that API::CompiledFormula supports are evaluated over the whole
+domain at once and have analytical derivatives. Others are evaluated point by
+point with muParser and differentiated numerically.
+
 @author Roman Tolchenov, Tessella plc
 @date 15/01/2010
 */
@@ -62,6 +72,8 @@ private:
   std::string m_formula;
   /// extended muParser instance
   mu::Parser *m_parser;
+  /// The compiled formula, if it can be compiled
+  std::unique_ptr<API::CompiledFormula> m_compiled;
   /// Used as 'x' variable in m_parser.
   mutable double m_x;
   /// True indicates that input formula contains 'x' variable
@@ -73,6 +85,10 @@ private:
 
   /// mu::Parser callback function for setting variables.
   static double *AddVariable(const char *varName, void *pufun);
+  /// The values of the parameters in the order they are declared
+  std::vector<double> parameterValues() const;
+  /// Whether any parameter is tied to the others
+  bool hasTiedParameters() const;
 };
 
 } // namespace Functions
@@ -22,6 +22,7 @@ class MANTID_CURVEFITTING_DLL Voigt : public API::IPeakFunction {
 private:
   /// Return a string identifier for the function
   std::string name() const override { return "Voigt"; }
+  bool threadSafe() const override { return true; }
   /// Declare parameters
   void declareParameters() override;
 
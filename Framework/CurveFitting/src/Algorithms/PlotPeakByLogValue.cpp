@@ -34,6 +34,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/MandatoryValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
 namespace {
@@ -245,10 +246,13 @@ void PlotPeakByLogValue::exec() {
     fitChiSquared.reserve(wsNames.size());
   }
 
-  double dProg = 1. / static_cast<double>(wsNames.size());
-  double Prog = 0.;
+  // Select the spectra to fit. The minimizers are created here as creating
+  // them records the workspaces they output.
+  m_minimizersRunConcurrently = true;
+  std::vector<int> spectraToFit;
+  std::vector<std::string> minimizers(wsNames.size());
   for (int i = 0; i < static_cast<int>(wsNames.size()); ++i) {
-    InputSpectraToFit data = wsNames[i];
+    const InputSpectraToFit &data = wsNames[i];
 
     if (!data.ws) {
       g_log.warning() << "Cannot access workspace " << data.name << '\n';
@@ -259,19 +263,72 @@ void PlotPeakByLogValue::exec() {
       g_log.warning() << "Zero spectra selected for fitting in workspace " << wsNames[i].name << '\n';
       continue;
     }
+    spectraToFit.emplace_back(i);
+    minimizers[i] = getMinimizerString(data.name, std::to_string(data.wsIdx));
+  }
+
+  const auto nFits = static_cast<int>(spectraToFit.size());
+  result->setRowCount(nFits);
+  if (createFitOutput) {
+    if (appendIdxToOutput) {
+      fitNames.resize(nFits);
+      parameterNames.resize(nFits);
+      covarianceNames.resize(nFits);
+    } else {
+      fitWorkspaces.resize(nFits);
+      parameterWorkspaces.resize(nFits);
+      covarianceWorkspaces.resize(nFits);
+    }
+  }
+  if (outputFitStatus) {
+    fitStatus.resize(nFits);
+    fitChiSquared.resize(nFits);
+  }
+
+  // Individual fits are independent of each other and run in parallel, unless
+  // the minimizer can not. Each single domain fit then needs a function of its
+  // own: the clones are kept for later fits so that the function is only
+  // parsed once per thread.
+  const bool parallelFits = individual && m_minimizersRunConcurrently &&
+                            std::all_of(spectraToFit.cbegin(), spectraToFit.cend(),
+                                        [&wsNames](int i) { return wsNames[i].ws->threadSafe(); });
+  const bool cloneFunction = parallelFits && !isMultiDomainFunction;
+  std::vector<IFunction_sptr> idleFunctions;
+  IFunction_sptr lastFunction;
+
+  Progress progress(this, 0.0, 1.0, nFits);
+  PARALLEL_FOR_IF(parallelFits)
+  for (int iFit = 0; iFit < nFits; ++iFit) {
+    PARALLEL_START_INTERRUPT_REGION
+    const int i = spectraToFit[iFit];
+    const InputSpectraToFit &data = wsNames[i];
+
+    IFunction_sptr fitFunction = inputFunction;
+    if (cloneFunction) {
+      fitFunction = nullptr;
+      PARALLEL_CRITICAL(PlotPeakByLogValue_functions) {
+        if (!idleFunctions.empty()) {
+          fitFunction = idleFunctions.back();
+          idleFunctions.pop_back();
+        }
+      }
+      if (!fitFunction) {
+        fitFunction = inputFunction->clone();
+      }
+    }
 
     IFunction_sptr ifun =
-        setupFunction(individual, passWSIndexToFunction, inputFunction, initialParams, isMultiDomainFunction, i, data);
+        setupFunction(individual, passWSIndexToFunction, fitFunction, initialParams, isMultiDomainFunction, i, data);
     std::shared_ptr<Algorithm> fit;
     if (startX.size() == 0) {
       fit = runSingleFit(createFitOutput, outputCompositeMembers, outputConvolvedMembers, appendIdxToOutput, ifun, data,
-                         EMPTY_DBL(), EMPTY_DBL(), exclude[i]);
+                         EMPTY_DBL(), EMPTY_DBL(), exclude[i], minimizers[i]);
     } else if (startX.size() == 1) {
       fit = runSingleFit(createFitOutput, outputCompositeMembers, outputConvolvedMembers, appendIdxToOutput, ifun, data,
-                         startX[0], endX[0], exclude[i]);
+                         startX[0], endX[0], exclude[i], minimizers[i]);
     } else {
       fit = runSingleFit(createFitOutput, outputCompositeMembers, outputConvolvedMembers, appendIdxToOutput, ifun, data,
-                         startX[i], endX[i], exclude[i]);
+                         startX[i], endX[i], exclude[i], minimizers[i]);
     }
 
     ifun = fit->getProperty("Function");
@@ -279,18 +336,18 @@ void PlotPeakByLogValue::exec() {
 
     if (createFitOutput) {
       if (appendIdxToOutput) {
-        fitNames.emplace_back(fit->getPropertyValue("OutputWorkspace"));
-        parameterNames.emplace_back(fit->getPropertyValue("OutputParameters"));
-        covarianceNames.emplace_back(fit->getPropertyValue("OutputNormalisedCovarianceMatrix"));
+        fitNames[iFit] = fit->getPropertyValue("OutputWorkspace");
+        parameterNames[iFit] = fit->getPropertyValue("OutputParameters");
+        covarianceNames[iFit] = fit->getPropertyValue("OutputNormalisedCovarianceMatrix");
       } else {
-        fitWorkspaces.emplace_back(fit->getProperty("OutputWorkspace"));
-        parameterWorkspaces.emplace_back(fit->getProperty("OutputParameters"));
-        covarianceWorkspaces.emplace_back(fit->getProperty("OutputNormalisedCovarianceMatrix"));
+        fitWorkspaces[iFit] = fit->getProperty("OutputWorkspace");
+        parameterWorkspaces[iFit] = fit->getProperty("OutputParameters");
+        covarianceWorkspaces[iFit] = fit->getProperty("OutputNormalisedCovarianceMatrix");
       }
     }
     if (outputFitStatus) {
-      fitStatus.push_back(fit->getProperty("OutputStatus"));
-      fitChiSquared.push_back(chi2);
+      fitStatus[iFit] = fit->getPropertyValue("OutputStatus");
+      fitChiSquared[iFit] = chi2;
     }
 
     g_log.debug() << "Fit result " << fit->getPropertyValue("OutputStatus") << ' ' << chi2 << '\n';
@@ -298,12 +355,27 @@ void PlotPeakByLogValue::exec() {
     // Find the log value: it is either a log-file value or
     // simply the workspace number
     double logValue = calculateLogValue(logName, data);
-    appendTableRow(isDataName, result, ifun, data, logValue, chi2);
+    setTableRow(isDataName, *result, iFit, ifun, data, logValue, chi2);
 
-    Prog += dProg;
-    std::string current = std::to_string(i);
-    progress(Prog, ("Fitting Workspace: (" + current + ") - "));
-    interruption_point();
+    if (cloneFunction) {
+      if (iFit == nFits - 1) {
+        lastFunction = ifun->clone();
+      }
+      PARALLEL_CRITICAL(PlotPeakByLogValue_functions) { idleFunctions.emplace_back(fitFunction); }
+    }
+
+    progress.report("Fitting Workspace: (" + std::to_string(i) + ") - ");
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  // Leave the function with the results of the last fit, as the fits in turn
+  // would have done
+  if (lastFunction) {
+    for (size_t i = 0; i < inputFunction->nParams(); ++i) {
+      inputFunction->setParameter(i, lastFunction->getParameter(i));
+      inputFunction->setError(i, lastFunction->getError(i));
+    }
   }
 
   if (outputFitStatus) {
@@ -504,10 +576,11 @@ void PlotPeakByLogValue::finaliseMinimizerOutput() {
   }
 }
 
-void PlotPeakByLogValue::appendTableRow(
-    bool isDataName, ITableWorkspace_sptr &result, const IFunction_sptr &ifun, const InputSpectraToFit &data,
-    double logValue, double chi2) const { // Extract the fitted parameters and put them into the result table
-  TableRow row = result->appendRow();
+void PlotPeakByLogValue::setTableRow(bool isDataName, ITableWorkspace &result, size_t rowIndex,
+                                     const IFunction_sptr &ifun, const InputSpectraToFit &data, double logValue,
+                                     double chi2) const {
+  // Extract the fitted parameters and put them into the result table
+  TableRow row = result.getRow(rowIndex);
   if (isDataName) {
     row << data.name;
   } else {
@@ -598,7 +671,8 @@ ITableWorkspace_sptr PlotPeakByLogValue::createResultsTable(const std::string &l
 std::shared_ptr<Algorithm> PlotPeakByLogValue::runSingleFit(bool createFitOutput, bool outputCompositeMembers,
                                                             bool outputConvolvedMembers, bool appendIdx,
                                                             const IFunction_sptr &ifun, const InputSpectraToFit &data,
-                                                            double startX, double endX, const std::string &exclude) {
+                                                            double startX, double endX, const std::string &exclude,
+                                                            const std::string &minimizer) {
   g_log.debug() << "Fitting " << data.ws->getName() << " index " << data.wsIdx << " with \n";
   g_log.debug() << ifun->asString() << '\n';
 
@@ -630,7 +704,7 @@ std::shared_ptr<Algorithm> PlotPeakByLogValue::runSingleFit(bool createFitOutput
   fit->setProperty("StartX", startX);
   fit->setProperty("EndX", endX);
   fit->setProperty("IgnoreInvalidData", ignoreInvalidData);
-  fit->setPropertyValue("Minimizer", this->getMinimizerString(data.name, std::to_string(data.wsIdx)));
+  fit->setPropertyValue("Minimizer", minimizer);
   fit->setPropertyValue("CostFunction", this->getPropertyValue("CostFunction"));
   fit->setPropertyValue("MaxIterations", this->getPropertyValue("MaxIterations"));
   fit->setPropertyValue("PeakRadius", this->getPropertyValue("PeakRadius"));
@@ -695,6 +769,7 @@ std::string PlotPeakByLogValue::getMinimizerString(const std::string &wsName, co
   boost::replace_all(format, "$outputname", m_baseName);
 
   auto minimizer = FuncMinimizerFactory::Instance().createMinimizer(format);
+  m_minimizersRunConcurrently = m_minimizersRunConcurrently && minimizer->canRunConcurrently();
   auto minimizerProps = minimizer->getProperties();
   for (auto &minimizerProp : minimizerProps) {
     const auto *wsProp = dynamic_cast<Mantid::API::WorkspaceProperty<> *>(minimizerProp);
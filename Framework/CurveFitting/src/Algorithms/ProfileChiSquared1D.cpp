@@ -5,23 +5,30 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidCurveFitting/Algorithms/ProfileChiSquared1D.h"
-#include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/Column.h"
+#include "MantidAPI/CompositeFunction.h"
+#include "MantidAPI/FuncMinimizerFactory.h"
+#include "MantidAPI/IFuncMinimizer.h"
 #include "MantidAPI/IFunction.h"
 #include "MantidAPI/ITableWorkspace.h"
-#include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidCurveFitting/Algorithms/CalculateChiSquared.h"
-#include "MantidCurveFitting/Algorithms/Fit.h"
+#include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
 #include "MantidCurveFitting/EigenJacobian.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <boost/math/distributions/chi_squared.hpp>
+#include <iterator>
+#include <map>
 #include <utility>
 
 namespace {
 // The maximum difference of chi squared to search for
 // 10.8276 covers  99.9% of the distrubition
 constexpr double MAXCHISQUAREDIFFERENCE = 10.8276;
+// The maximum number of iterations of a re-fit at a point of a slice
+constexpr size_t MAXITERATIONS = 500;
 
 /// Calculate the change in chi2
 /// @param domain :: Function's domain.
@@ -50,52 +57,49 @@ using namespace Mantid::API;
 class ChiSlice {
 public:
   /// Constructor.
-  /// @param inputFunction :: The fitting function
+  /// @param function :: The fitting function. The slice takes it over: the
+  /// fixed parameter stays fixed and the others are refitted at each point.
   /// @param fixedParameterIndex :: index of the parameter which is fixed
-  /// @param inputWS :: The input workspace (used for fit algorithm)
-  /// @param workspaceIndex :: Workspace index (used for fit algorithm)
   /// @param domain :: Function's domain.
   /// @param values :: Functin's values.
   /// @param chi0 :: Chi squared at the minimum.
-  /// @param freeParameters :: Parameters which are free in the function.
-  ChiSlice(IFunction_sptr inputFunction, int fixedParameterIndex, API::MatrixWorkspace_sptr inputWS, int workspaceIndex,
-           const API::FunctionDomain &domain, API::FunctionValues &values, double chi0,
-           std::vector<int> &freeParameters)
-      : m_fixedParameterIndex(fixedParameterIndex), m_domain(domain), m_values(values), m_chi0(chi0),
-        m_fitalg(AlgorithmFactory::Instance().create("Fit", -1)), m_function(std::move(inputFunction)),
-        m_ws(std::move(inputWS)), m_workspaceIndex(workspaceIndex), m_freeParameters(freeParameters) {
-    // create a fitting algorithm based on least squares (which is the default)
-    m_fitalg->setChild(true);
+  /// @param nFreeParameters :: Number of parameters which are free in the function.
+  ChiSlice(IFunction_sptr function, int fixedParameterIndex, API::FunctionDomain_sptr domain,
+           API::FunctionValues_sptr values, double chi0, size_t nFreeParameters)
+      : m_fixedParameterIndex(fixedParameterIndex), m_domain(std::move(domain)), m_values(std::move(values)),
+        m_chi0(chi0), m_function(std::move(function)), m_nFreeParameters(nFreeParameters),
+        m_fixedParameterValue(m_function->getParameter(fixedParameterIndex)) {
+    // The minimum is the solution at the origin of the slice
+    auto &minimum = m_solutions[0.0];
+    for (size_t ip = 0; ip < m_function->nParams(); ++ip) {
+      minimum.emplace_back(m_function->getParameter(ip));
+    }
+    m_function->fix(m_fixedParameterIndex);
   }
   /// Calculate the value of chi squared along the chosen direction at a
   /// distance from
   /// the minimum point.
   /// @param p :: A distance from the minimum.
   double operator()(double p) {
-    m_fitalg->initialize();
-    m_fitalg->setProperty("Function", m_function);
-    m_fitalg->setProperty("InputWorkspace", m_ws);
-    m_fitalg->setProperty("WorkspaceIndex", m_workspaceIndex);
-    IFunction_sptr function = m_fitalg->getProperty("Function");
-    std::vector<double> originalParamValues(function->nParams());
-    for (auto ip = 0u; ip < function->nParams(); ++ip) {
-      originalParamValues[ip] = function->getParameter(ip);
+    // Start from the solution at the nearest point already visited: it is
+    // usually much closer to the new minimum than the global one.
+    const auto &start = nearestSolution(p);
+    for (size_t ip = 0; ip < start.size(); ++ip) {
+      m_function->setParameter(ip, start[ip]);
     }
-    function->setParameter(m_fixedParameterIndex, originalParamValues[m_fixedParameterIndex] + p);
-    function->fix(m_fixedParameterIndex);
+    m_function->setParameter(m_fixedParameterIndex, m_fixedParameterValue + p);
 
     // re run the fit to minimze the unfixed parameters
-    m_fitalg->execute();
+    minimize();
     // find change in chi 2
     // num free parameters is the number of global free parameters - the 1 we've
     // just fixed
-    int numFreeParameters = static_cast<int>(m_freeParameters.size() - 1);
-    double res = getDiff(*function, numFreeParameters, m_domain, m_values, m_chi0);
-    // reset fit to original values
-    for (auto ip = 0u; ip < function->nParams(); ++ip) {
-      function->setParameter(ip, originalParamValues[ip]);
+    double res = getDiff(*m_function, m_nFreeParameters - 1, *m_domain, *m_values, m_chi0);
+    auto &solution = m_solutions[p];
+    solution.resize(m_function->nParams());
+    for (size_t ip = 0; ip < solution.size(); ++ip) {
+      solution[ip] = m_function->getParameter(ip);
     }
-    function->unfix(m_fixedParameterIndex);
     return res;
   }
 
@@ -155,22 +159,71 @@ public:
   }
 
 private:
+  /// Minimize the least squares of the free parameters with the
+  /// Levenberg-Marquardt minimizer, as Fit does by default.
+  void minimize() {
+    auto minimizer = createMinimizer(MAXITERATIONS);
+    for (size_t iter = 0; iter < MAXITERATIONS; ++iter) {
+      bool isFinished = false;
+      try {
+        m_function->iterationStarting();
+        isFinished = !minimizer->iterate(iter);
+        m_function->iterationFinished();
+      } catch (Kernel::Exception::FitSizeWarning &) {
+        // Recover as Fit does after the function changes its number of
+        // parameters or ties during the iteration.
+        if (auto cf = dynamic_cast<API::CompositeFunction *>(m_function.get())) {
+          cf->checkFunction();
+        }
+        minimizer = createMinimizer(MAXITERATIONS - iter);
+      }
+      if (isFinished) {
+        break;
+      }
+    }
+  }
+
+  /// Create a minimizer of the least squares of the function's free parameters.
+  /// @param maxIterations :: The maximum number of iterations the minimizer may do.
+  IFuncMinimizer_sptr createMinimizer(size_t maxIterations) const {
+    auto costFunction = std::make_shared<CostFunctions::CostFuncLeastSquares>();
+    costFunction->setFittingFunction(m_function, m_domain, m_values);
+    auto minimizer = FuncMinimizerFactory::Instance().createMinimizer("Levenberg-Marquardt");
+    minimizer->initialize(costFunction, maxIterations);
+    return minimizer;
+  }
+
+  /// Find the parameters minimizing the chi squared at the visited point
+  /// nearest to a distance from the minimum.
+  /// @param p :: A distance from the minimum.
+  const std::vector<double> &nearestSolution(double p) const {
+    auto next = m_solutions.lower_bound(p);
+    if (next == m_solutions.end()) {
+      return std::prev(next)->second;
+    }
+    if (next == m_solutions.begin()) {
+      return next->second;
+    }
+    auto previous = std::prev(next);
+    return p - previous->first < next->first - p ? previous->second : next->second;
+  }
+
   // Fixed parameter index
   int m_fixedParameterIndex;
   /// The domain
-  const API::FunctionDomain &m_domain;
+  API::FunctionDomain_sptr m_domain;
   /// The values
-  API::FunctionValues &m_values;
+  API::FunctionValues_sptr m_values;
   /// The chi squared at the minimum
   double m_chi0;
-  // fitting algorithm
-  IAlgorithm_sptr m_fitalg;
-  // Input workspace and function
+  /// The function refitted at each point
   IFunction_sptr m_function;
-  MatrixWorkspace_sptr m_ws;
-  int m_workspaceIndex;
-  // Vector of free parameter indices
-  std::vector<int> m_freeParameters;
+  /// Number of free parameters
+  size_t m_nFreeParameters;
+  /// Value of the fixed parameter at the minimum
+  double m_fixedParameterValue;
+  /// Parameters minimizing the chi squared at the points visited so far
+  std::map<double, std::vector<double>> m_solutions;
 }; // namespace Algorithms
 
 /// Default constructor
@@ -219,9 +272,6 @@ void ProfileChiSquared1D::execConcrete() {
   }
 
   std::string baseName = getProperty("Output");
-  Workspace_sptr ws = getProperty("InputWorkspace");
-  int workspaceIndex = getProperty("WorkspaceIndex");
-  MatrixWorkspace_sptr inputws = std::dynamic_pointer_cast<MatrixWorkspace>(ws);
   if (baseName.empty()) {
     baseName = "ProfileChiSquared1D";
   }
@@ -267,12 +317,31 @@ void ProfileChiSquared1D::execConcrete() {
   pdfTable->setRowCount(n);
   const double fac = 1e-4;
 
-  for (auto p = 0u; p < freeParameters.size(); ++p) {
-    int row = p;
+  // Give each parameter a slice with its own copy of the function and of the
+  // domain, so that the parameters can be profiled in parallel. The slices,
+  // the output columns and the parameter names are made up front because
+  // neither the factories nor the tables are safe to change concurrently.
+  const auto nFree = static_cast<int>(freeParameters.size());
+  std::vector<std::unique_ptr<ChiSlice>> slices;
+  std::vector<std::array<Column_sptr, 3>> pdfColumns;
+  for (auto p = 0; p < nFree; ++p) {
     int ip = freeParameters[p];
+    auto function = m_function->clone();
+    for (size_t i = 0; i < nParams; ++i) {
+      function->setParameter(i, m_function->getParameter(i));
+    }
+    function->sortTies();
+    function->setUpForFit();
+    API::FunctionDomain_sptr sliceDomain;
+    API::FunctionValues_sptr sliceValues;
+    m_domainCreator->createDomain(sliceDomain, sliceValues);
+    m_domainCreator->initFunction(function);
+    slices.emplace_back(
+        std::make_unique<ChiSlice>(function, ip, sliceDomain, sliceValues, chi0, freeParameters.size()));
+
     // Add columns for the parameter to the pdf table.
     auto parName = m_function->parameterName(ip);
-    nameColumn->read(row, parName);
+    nameColumn->read(p, parName);
     // Parameter values
     auto col1 = pdfTable->addColumn("double", parName);
     col1->setPlotType(1);
@@ -282,6 +351,16 @@ void ProfileChiSquared1D::execConcrete() {
     // PDF values
     auto col3 = pdfTable->addColumn("double", parName + "_pdf");
     col3->setPlotType(2);
+    pdfColumns.push_back({col1, col2, col3});
+  }
+
+  PARALLEL_FOR_IF(m_function->threadSafe())
+  for (auto p = 0; p < nFree; ++p) {
+    PARALLEL_START_INTERRUPT_REGION
+    int row = p;
+    int ip = freeParameters[p];
+    auto &slice = *slices[p];
+    const auto &[col1, col2, col3] = pdfColumns[p];
 
     double par0 = m_function->getParameter(ip);
     double shift = fabs(par0 * fac);
@@ -289,9 +368,6 @@ void ProfileChiSquared1D::execConcrete() {
       shift = fac;
     }
 
-    // Make a slice along this parameter
-    ChiSlice slice(m_function, ip, inputws, workspaceIndex, *domain, *values, chi0, freeParameters);
-
     // Find the bounds withn which the PDF is significantly above zero.
     // The bounds are defined relative to par0:
     //   par0 + lBound is the lowest value of the parameter (lBound <= 0)
@@ -354,9 +430,9 @@ void ProfileChiSquared1D::execConcrete() {
       double chi = col2->toDouble(i);
       col3->fromDouble(i, exp(-chi + chiMin));
     }
-    // reset parameter values back to original value
-    m_function->setParameter(ip, par0);
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
 
   // Square roots of the diagonals of the covariance matrix give
   // the standard deviations in the quadratic approximation of the chi^2.
@@ -9,6 +9,7 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/CostFunctions/CostFuncLeastSquares.h"
 #include "MantidAPI/CompositeDomain.h"
+#include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/IConstraint.h"
 #include "MantidCurveFitting/Jacobian.h"
@@ -16,6 +17,9 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/MultiThreaded.h"
 
+#include <Eigen/Core>
+
+#include <algorithm>
 #include <sstream>
 
 namespace Mantid::CurveFitting::CostFunctions {
@@ -29,7 +33,34 @@ DECLARE_COSTFUNCTION(CostFuncLeastSquares, Least squares)
 /**
  * Constructor
  */
-CostFuncLeastSquares::CostFuncLeastSquares() : CostFuncFitting(), m_factor(0.5) {}
+CostFuncLeastSquares::CostFuncLeastSquares() : CostFuncFitting(), m_factor(0.5), m_reuseMemberValues(false) {}
+
+/**
+ * Keep the values of the members of a composite fitting function between
+ * evaluations and only recalculate the members whose parameters changed.
+ * This pays off when few parameters change at a time, as in Monte Carlo
+ * minimizers.
+ * @param reuse :: True to keep the member values
+ */
+void CostFuncLeastSquares::setReuseMemberValues(bool reuse) {
+  m_reuseMemberValues = reuse;
+  m_memberValues.clear();
+}
+
+/** Set fitting function, domain it will operate on, and container for values.
+ * The kept member values were calculated on the previous domain, so they are
+ * dropped.
+ * @param function :: The fitting function.
+ * @param domain :: The domain for the function.
+ * @param values :: The FunctionValues object which receives the calculated
+ * values and also contains the data to fit to and the fitting weights.
+ */
+void CostFuncLeastSquares::setFittingFunction(API::IFunction_sptr function, API::FunctionDomain_sptr domain,
+                                              API::FunctionValues_sptr values) {
+  m_memberValues.clear();
+  CostFuncFitting::setFittingFunction(std::move(function), std::move(domain), std::move(values));
+}
+
 /**
  * Add a contribution to the cost function value from the fitting function
  * evaluated on a particular domain.
@@ -37,7 +68,11 @@ CostFuncLeastSquares::CostFuncLeastSquares() : CostFuncFitting(), m_factor(0.5)
  * @param values :: Values
  */
 void CostFuncLeastSquares::addVal(API::FunctionDomain_sptr domain, API::FunctionValues_sptr values) const {
-  m_function->function(*domain, *values);
+  if (m_reuseMemberValues && domain == m_domain) {
+    calculateByMembers(*domain, *values);
+  } else {
+    m_function->function(*domain, *values);
+  }
   size_t ny = values->size();
 
   double retVal = 0.0;
@@ -53,6 +88,49 @@ void CostFuncLeastSquares::addVal(API::FunctionDomain_sptr domain, API::Function
   m_value += m_factor * retVal;
 }
 
+/**
+ * Calculate the fitting function as the sum of its members, recalculating
+ * only the members whose parameters changed since the last call. Functions
+ * other than a plain CompositeFunction are calculated as usual.
+ * @param domain :: The domain
+ * @param values :: Values to receive the function's values
+ */
+void CostFuncLeastSquares::calculateByMembers(const API::FunctionDomain &domain, API::FunctionValues &values) const {
+  auto composite = std::dynamic_pointer_cast<API::CompositeFunction>(m_function);
+  if (!composite || composite->name() != "CompositeFunction") {
+    m_function->function(domain, values);
+    return;
+  }
+  const size_t nMembers = composite->nFunctions();
+  m_memberValues.resize(nMembers);
+  values.zeroCalculated();
+  API::FunctionValues tmp(domain);
+  for (size_t iFun = 0; iFun < nMembers; ++iFun) {
+    auto member = composite->getFunction(iFun);
+    auto &cache = m_memberValues[iFun];
+    bool isCurrent = cache.function == member && cache.calculated.size() == values.size() &&
+                     cache.parameters.size() == member->nParams();
+    for (size_t i = 0; isCurrent && i < cache.parameters.size(); ++i) {
+      isCurrent = cache.parameters[i] == member->getParameter(i);
+    }
+    if (!isCurrent) {
+      member->function(domain, tmp);
+      cache.function = member;
+      cache.parameters.resize(member->nParams());
+      for (size_t i = 0; i < cache.parameters.size(); ++i) {
+        cache.parameters[i] = member->getParameter(i);
+      }
+      cache.calculated.resize(tmp.size());
+      for (size_t i = 0; i < tmp.size(); ++i) {
+        cache.calculated[i] = tmp.getCalculated(i);
+      }
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      values.addToCalculated(i, cache.calculated[i]);
+    }
+  }
+}
+
 /**
  * Update the cost function, derivatives and hessian by adding values calculated
  * on a domain.
@@ -71,73 +149,46 @@ void CostFuncLeastSquares::addValDerivHessian(API::IFunction_sptr function, API:
   Jacobian jacobian(ny, np);
   function->functionDeriv(*domain, jacobian);
 
-  size_t iActiveP = 0;
-  double fVal = 0.0;
-  std::vector<double> weights = getFitWeights(values);
-
-  for (size_t ip = 0; ip < np; ++ip) {
-    if (!function->isActive(ip))
-      continue;
-
-    double d = 0.0;
-    for (size_t i = 0; i < ny; ++i) {
-      double calc = values->getCalculated(i);
-      double obs = values->getFitData(i);
-      double w = weights[i];
-      double y = (calc - obs) * w;
-      d += y * jacobian.get(i, ip) * w;
-      if (iActiveP == 0) {
-        fVal += y * y;
-      }
-    }
-    PARALLEL_CRITICAL(der_set) {
-      double der = m_der.get(iActiveP);
-      m_der.set(iActiveP, der + d);
-    }
-    ++iActiveP;
-
-    if (iActiveP >= m_der.size())
-      break;
+  std::vector<size_t> activeParameters;
+  for (size_t ip = 0; ip < np && activeParameters.size() < m_der.size(); ++ip) {
+    if (function->isActive(ip))
+      activeParameters.emplace_back(ip);
   }
-
-  PARALLEL_ATOMIC
-  m_value += 0.5 * fVal;
-
-  if (!evalHessian)
+  if (activeParameters.empty())
     return;
+  const size_t nActive = activeParameters.size();
 
-  size_t i1 = 0;                  // active parameter index
-  for (size_t i = 0; i < np; ++i) // over parameters
-  {
-    if (!function->isActive(i))
-      continue;
-    size_t i2 = 0;                  // active parameter index
-    for (size_t j = 0; j <= i; ++j) // over ~ half of parameters
-    {
-      if (!function->isActive(j))
-        continue;
-      double d = 0.0;
-      for (size_t k = 0; k < ny; ++k) // over fitting data
-      {
-        double w = weights[k];
-        d += jacobian.get(k, i) * jacobian.get(k, j) * w * w;
-      }
-      PARALLEL_CRITICAL(hessian_set) {
-        double h = m_hessian.get(i1, i2);
-        m_hessian.set(i1, i2, h + d);
-        if (i1 != i2) {
-          m_hessian.set(i2, i1, h + d);
-        }
-      }
-      ++i2;
-
-      if (i2 >= m_hessian.size2())
-        break;
+  // Gather the weighted residuals and the weighted derivatives of the active
+  // parameters into contiguous blocks, so that the gradient and the Hessian
+  // are each a single matrix product
+  std::vector<double> weights = getFitWeights(values);
+  Eigen::VectorXd residuals(ny);
+  Eigen::MatrixXd weightedJacobian(ny, nActive);
+  const double *derivatives = jacobian.data().data();
+  for (size_t i = 0; i < ny; ++i, derivatives += np) {
+    const double w = weights[i];
+    residuals(i) = (values->getCalculated(i) - values->getFitData(i)) * w;
+    for (size_t ia = 0; ia < nActive; ++ia) {
+      weightedJacobian(i, ia) = derivatives[activeParameters[ia]] * w;
     }
-    ++i1;
+  }
+  const double fVal = residuals.squaredNorm();
+  const Eigen::VectorXd der = weightedJacobian.transpose() * residuals;
+
+  // J^T.W.J, only the lower triangle is computed
+  const size_t nHessian = evalHessian ? std::min({nActive, m_hessian.size1(), m_hessian.size2()}) : 0;
+  Eigen::MatrixXd hessian = Eigen::MatrixXd::Zero(nHessian, nHessian);
+  if (nHessian > 0) {
+    hessian.selfadjointView<Eigen::Lower>().rankUpdate(weightedJacobian.leftCols(nHessian).transpose());
+    hessian.triangularView<Eigen::StrictlyUpper>() = hessian.transpose();
+  }
 
-    if (i1 >= m_hessian.size1())
-      break;
+  PARALLEL_CRITICAL(val_deriv_hessian_add) {
+    m_value += 0.5 * fVal;
+    m_der.mutator().head(nActive) += der;
+    if (nHessian > 0) {
+      m_hessian.mutator().topLeftCorner(nHessian, nHessian) += hessian;
+    }
   }
 }
 
@@ -16,6 +16,8 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/MultiThreaded.h"
 
+#include <Eigen/Core>
+
 #include <cmath>
 #include <limits>
 
@@ -32,6 +34,13 @@ double calculatePoissonLoss(double observedCounts, double predicted) {
   return retVal;
 }
 
+/// A view of the derivatives in a Jacobian as a matrix with a row per data point
+using JacobianMap = Eigen::Map<const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+JacobianMap asMatrix(const Mantid::CurveFitting::Jacobian &jacobian, const size_t numDataPoints,
+                     const size_t numParams) {
+  return JacobianMap(jacobian.data().data(), numDataPoints, numParams);
+}
+
 } // namespace
 
 namespace Mantid::CurveFitting::CostFunctions {
@@ -112,55 +121,51 @@ void CostFuncPoisson::calculateDerivative(API::IFunction &function, const Functi
   function.function(domain, values);
   function.functionDeriv(domain, jacobian);
 
-  size_t activeParamIndex = 0;
-  double costVal = 0.0;
-
+  std::vector<size_t> activeParams;
   for (size_t paramIndex = 0; paramIndex < numParams; ++paramIndex) {
-    if (!function.isActive(paramIndex))
-      continue;
-
-    double determinant = 0.0;
-    for (size_t i = 0; i < numDataPoints; ++i) {
-      double calc = values.getCalculated(i);
-      double obs = values.getFitData(i);
-
-      if (calc <= absoluteCutOff) {
-        if (activeParamIndex == 0) {
-          costVal += std::numeric_limits<double>::infinity();
-        }
-        determinant += std::numeric_limits<double>::infinity();
-        continue;
-      }
-
-      if (calc <= effectiveCutOff) {
-        if (activeParamIndex == 0) {
-          costVal += (effectiveCutOff - calc) / (calc - absoluteCutOff);
-        }
-        double tmp = calc - absoluteCutOff;
-        determinant += jacobian.get(i, paramIndex) * (absoluteCutOff - effectiveCutOff) / (tmp * tmp);
-
-      } else if (obs == 0.0) {
-        if (activeParamIndex == 0) {
-          costVal += calc;
-        }
-        determinant += jacobian.get(i, paramIndex);
-
-      } else {
-        if (activeParamIndex == 0) {
-          costVal += calculatePoissonLoss(obs, calc);
-        }
-        determinant += jacobian.get(i, paramIndex) * (1.0 - obs / calc);
-      }
-    }
-    PARALLEL_CRITICAL(der_set) {
-      double der = m_der.get(activeParamIndex);
-      m_der.set(activeParamIndex, der + determinant);
+    if (function.isActive(paramIndex))
+      activeParams.emplace_back(paramIndex);
+  }
+  if (activeParams.empty())
+    return;
+
+  // The derivative of the cost with respect to each calculated value. Points
+  // below the cut off make the cost and every derivative infinite.
+  Eigen::VectorXd costDerivs(numDataPoints);
+  double costVal = 0.0;
+  bool belowCutOff = false;
+  for (size_t i = 0; i < numDataPoints; ++i) {
+    double calc = values.getCalculated(i);
+    double obs = values.getFitData(i);
+
+    if (calc <= absoluteCutOff) {
+      belowCutOff = true;
+      costDerivs(i) = 0.0;
+    } else if (calc <= effectiveCutOff) {
+      costVal += (effectiveCutOff - calc) / (calc - absoluteCutOff);
+      double tmp = calc - absoluteCutOff;
+      costDerivs(i) = (absoluteCutOff - effectiveCutOff) / (tmp * tmp);
+    } else if (obs == 0.0) {
+      costVal += calc;
+      costDerivs(i) = 1.0;
+    } else {
+      costVal += calculatePoissonLoss(obs, calc);
+      costDerivs(i) = 1.0 - obs / calc;
     }
-    ++activeParamIndex;
   }
+  if (belowCutOff)
+    costVal = std::numeric_limits<double>::infinity();
 
-  PARALLEL_ATOMIC
-  m_value += 2.0 * costVal;
+  const Eigen::VectorXd derivs = asMatrix(jacobian, numDataPoints, numParams).transpose() * costDerivs;
+
+  PARALLEL_CRITICAL(val_deriv_add) {
+    for (size_t activeParamIndex = 0; activeParamIndex < activeParams.size(); ++activeParamIndex) {
+      const double determinant =
+          belowCutOff ? std::numeric_limits<double>::infinity() : derivs(activeParams[activeParamIndex]);
+      m_der.set(activeParamIndex, m_der.get(activeParamIndex) + determinant);
+    }
+    m_value += 2.0 * costVal;
+  }
 }
 
 void CostFuncPoisson::calculateHessian(API::IFunction &function, const API::FunctionDomain &domain,
@@ -170,13 +175,41 @@ void CostFuncPoisson::calculateHessian(API::IFunction &function, const API::Func
 
   Jacobian jacobian(numDataPoints, numParams);
   function.functionDeriv(domain, jacobian);
+  const auto derivs = asMatrix(jacobian, numDataPoints, numParams);
+
+  // Each element of the Hessian sums the second derivatives of the calculated
+  // values times firstCoeffs and products of their first derivatives times
+  // secondCoeffs. Points below the cut off make every element infinite.
+  Eigen::VectorXd firstCoeffs(numDataPoints), secondCoeffs(numDataPoints);
+  bool belowCutOff = false;
+  for (size_t k = 0; k < numDataPoints; ++k) {
+    double calc = values.getCalculated(k);
+    double obs = values.getFitData(k);
+    if (calc <= absoluteCutOff) {
+      belowCutOff = true;
+      firstCoeffs(k) = secondCoeffs(k) = 0.0;
+    } else if (calc <= effectiveCutOff) {
+      double constrainedCalc = calc - absoluteCutOff;
+      firstCoeffs(k) = (absoluteCutOff - effectiveCutOff) / (constrainedCalc * constrainedCalc);
+      secondCoeffs(k) =
+          (effectiveCutOff - absoluteCutOff) * 2 / (constrainedCalc * constrainedCalc * constrainedCalc);
+    } else if (obs == 0.0) {
+      firstCoeffs(k) = 1.0;
+      secondCoeffs(k) = 0.0;
+    } else {
+      firstCoeffs(k) = 1.0 - obs / calc;
+      secondCoeffs(k) = obs / (calc * calc);
+    }
+  }
 
-  size_t activeParamFirstIndex = 0; // The params are split into two halves and iterated through
+  std::vector<size_t> activeParams;
   for (size_t paramIndex = 0; paramIndex < numParams; ++paramIndex) {
-
-    if (!function.isActive(paramIndex))
-      continue;
-    size_t activeParamSecondIndex = 0; // The counterpart index
+    if (function.isActive(paramIndex))
+      activeParams.emplace_back(paramIndex);
+  }
+  Eigen::MatrixXd hessian(activeParams.size(), activeParams.size());
+  for (size_t activeParamFirstIndex = 0; activeParamFirstIndex < activeParams.size(); ++activeParamFirstIndex) {
+    const size_t paramIndex = activeParams[activeParamFirstIndex];
     double parameter = function.getParameter(paramIndex);
 
     double scalingFactor = 1e-4;
@@ -189,43 +222,22 @@ void CostFuncPoisson::calculateHessian(API::IFunction &function, const API::Func
     function.functionDeriv(domain, jacobian2);
     function.setParameter(paramIndex, parameter);
 
-    for (size_t j = 0; j <= paramIndex; ++j) // over ~ half of parameters
-    {
-      if (!function.isActive(j))
-        continue;
-      double d = 0.0;
-      for (size_t k = 0; k < numDataPoints; ++k) // over fitting data
-      {
-        double d2 = (jacobian2.get(k, j) - jacobian.get(k, j)) / scalingFactor;
-
-        double calc = values.getCalculated(k);
-        double obs = values.getFitData(k);
-        if (calc <= absoluteCutOff) {
-          d += std::numeric_limits<double>::infinity();
-        } else {
-          if (calc <= effectiveCutOff) {
-            double constrainedCalc = calc - absoluteCutOff;
-            d += d2 * (absoluteCutOff - effectiveCutOff) / (constrainedCalc * constrainedCalc);
-            d += jacobian.get(k, paramIndex) * jacobian.get(k, j) * (effectiveCutOff - absoluteCutOff) * 2 /
-                 (constrainedCalc * constrainedCalc * constrainedCalc);
-          } else if (obs == 0.0) {
-            d += d2;
-          } else {
-            d += d2 * (1.0 - obs / calc);
-            d += jacobian.get(k, paramIndex) * jacobian.get(k, j) * obs / (calc * calc);
-          }
-        }
-      }
-      PARALLEL_CRITICAL(hessian_set) {
-        double h = m_hessian.get(activeParamFirstIndex, activeParamSecondIndex) + d;
-        m_hessian.set(activeParamFirstIndex, activeParamSecondIndex, h);
-        if (activeParamFirstIndex != activeParamSecondIndex) {
-          m_hessian.set(activeParamSecondIndex, activeParamFirstIndex, h);
-        }
-      }
-      ++activeParamSecondIndex;
+    // one row of the Hessian for all parameters at once
+    const Eigen::VectorXd row =
+        (asMatrix(jacobian2, numDataPoints, numParams) - derivs).transpose() * firstCoeffs / scalingFactor +
+        derivs.transpose() * derivs.col(paramIndex).cwiseProduct(secondCoeffs);
+    // The params are split into two halves and iterated through
+    for (size_t activeParamSecondIndex = 0; activeParamSecondIndex <= activeParamFirstIndex;
+         ++activeParamSecondIndex) {
+      const double d =
+          belowCutOff ? std::numeric_limits<double>::infinity() : row(activeParams[activeParamSecondIndex]);
+      hessian(activeParamFirstIndex, activeParamSecondIndex) = d;
+      hessian(activeParamSecondIndex, activeParamFirstIndex) = d;
     }
-    ++activeParamFirstIndex;
+  }
+
+  PARALLEL_CRITICAL(hessian_add) {
+    m_hessian.mutator().topLeftCorner(hessian.rows(), hessian.cols()) += hessian;
   }
 }
 
@@ -51,8 +51,6 @@ const size_t LOWER_CONVERGENCE_LIMIT = 350;
 const size_t JUMP_CHECKING_RATE = 200;
 // low jump limit
 const double LOW_JUMP_LIMIT = 1e-25;
-// random number generator
-std::mt19937 rng;
 
 API::MatrixWorkspace_sptr createWorkspace(std::vector<double> const &xValues, std::vector<double> const &yValues,
                                           int const numberOfSpectra,
@@ -77,7 +75,8 @@ DECLARE_FUNCMINIMIZER(FABADAMinimizer, FABADA)
 
 /// Constructor
 FABADAMinimizer::FABADAMinimizer()
-    : m_counter(0), m_chainIterations(0), m_changes(), m_jump(), m_parameters(), m_chain(), m_chi2(0.),
+    : m_counter(0), m_chainIterations(0), m_changes(), m_jump(), m_parameters(), m_chain(), m_storeFullChain(true),
+      m_chainSize(0), m_stepsBetweenValues(10), m_chi2(0.),
       m_converged(false), m_convPoint(0), m_parConverged(), m_criteria(), m_maxIter(0), m_parChanged(),
       m_temperature(0.), m_counterGlobal(0), m_simAnnealingItStep(0), m_leftRefrPoints(0), m_tempStep(0.),
       m_overexploration(false), m_nParams(0), m_numInactiveRegenerations(), m_changesOld() {
@@ -103,6 +102,9 @@ FABADAMinimizer::FABADAMinimizer()
                   " no error will jump for that (The temperature is"
                   " constant during the convergence period)."
                   " Useful to find the exact minimum.");
+  declareProperty("Seed", static_cast<int>(std::mt19937::default_seed),
+                  "Seed for the random number generator. Fits with the same"
+                  " seed take the same steps.");
   // Output Properties
   declareProperty("PDF", DEFAULT_PDF_GROUP_NAME,
                   "Name for the output PDF workspace group. Default is " + DEFAULT_PDF_GROUP_NAME);
@@ -143,11 +145,17 @@ void FABADAMinimizer::initialize(API::ICostFunction_sptr function, size_t maxIte
   }
 
   m_fitFunction = m_leastSquares->getFittingFunction();
+  // Only one parameter changes at each step, so only the member of a
+  // composite function holding it needs recalculating
+  m_leastSquares->setReuseMemberValues(true);
   m_counter = 0;
   m_counterGlobal = 0;
   m_converged = false;
   m_maxIter = maxIterations;
 
+  const int seed = getProperty("Seed");
+  m_randomGenerator.seed(static_cast<std::mt19937::result_type>(seed));
+
   // Initialize member variables related to fitting parameters, such as
   // m_chains, m_jump, etc
   initChainsAndParameters();
@@ -297,14 +305,7 @@ void FABADAMinimizer::finalize() {
   // Creating the reduced chain (considering only one each
   // "Steps between values" values)
   size_t chainLength = getProperty("ChainLength");
-  int nSteps = getProperty("StepsBetweenValues");
-  if (nSteps <= 0) {
-    g_log.warning() << "StepsBetweenValues has a non valid value"
-                       " (<= 0). Default one used"
-                       " (StepsBetweenValues = 10).\n";
-    nSteps = 10;
-  }
-  auto convLength = size_t(double(chainLength) / double(nSteps));
+  auto convLength = size_t(double(chainLength) / double(m_stepsBetweenValues));
 
   // Reduced chain
   std::vector<std::vector<double>> reducedConvergedChain;
@@ -313,7 +314,7 @@ void FABADAMinimizer::finalize() {
   std::vector<double> errorLeft(m_nParams);
   std::vector<double> errorRight(m_nParams);
 
-  calculateConvChainAndBestParameters(convLength, nSteps, reducedConvergedChain, bestParameters, errorLeft, errorRight);
+  calculateConvChainAndBestParameters(convLength, reducedConvergedChain, bestParameters, errorLeft, errorRight);
 
   if (!getPropertyValue("Parameters").empty()) {
     outputParameterTable(bestParameters, errorLeft, errorRight);
@@ -331,6 +332,7 @@ void FABADAMinimizer::finalize() {
   leastSquaresMaleable->setDirtyInherited();
   // Convert back to base class
   m_leastSquares = std::dynamic_pointer_cast<CostFunctions::CostFuncLeastSquares>(leastSquaresMaleable);
+  m_leastSquares->setReuseMemberValues(false);
 
   // If required, output the complete chain
   if (!getPropertyValue("Chains").empty()) {
@@ -340,7 +342,7 @@ void FABADAMinimizer::finalize() {
   double mostPchi2 = outputPDF(convLength, reducedConvergedChain);
 
   if (!getPropertyValue("ConvergedChain").empty()) {
-    outputConvergedChains(convLength, nSteps);
+    outputConvergedChains(convLength);
   }
 
   if (!getPropertyValue("CostFunctionTable").empty()) {
@@ -361,7 +363,7 @@ void FABADAMinimizer::finalize() {
  * @return :: the step
  */
 double FABADAMinimizer::gaussianStep(const double &jump) {
-  return Kernel::normal_distribution<double>(0.0, std::abs(jump))(rng);
+  return Kernel::normal_distribution<double>(0.0, std::abs(jump))(m_randomGenerator);
 }
 
 /** If the new point is out of its bounds, it is changed to fit in the bound
@@ -460,10 +462,7 @@ void FABADAMinimizer::algorithmDisplacement(const size_t &parameterIndex, const
 
   // If new Chi square value is lower, jumping directly to new parameter
   if (chi2New < m_chi2) {
-    for (size_t j = 0; j < m_nParams; j++) {
-      m_chain[j].emplace_back(newParameters.get(j));
-    }
-    m_chain[m_nParams].emplace_back(chi2New);
+    appendToChain(newParameters, chi2New);
     m_parameters = newParameters;
     m_chi2 = chi2New;
     m_changes[parameterIndex] += 1;
@@ -475,20 +474,14 @@ void FABADAMinimizer::algorithmDisplacement(const size_t &parameterIndex, const
     double prob = exp((m_chi2 - chi2New) / (2.0 * m_temperature));
 
     // Decide if changing or not
-    double p = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+    double p = std::uniform_real_distribution<double>(0.0, 1.0)(m_randomGenerator);
     if (p <= prob) {
-      for (size_t j = 0; j < m_nParams; j++) {
-        m_chain[j].emplace_back(newParameters.get(j));
-      }
-      m_chain[m_nParams].emplace_back(chi2New);
+      appendToChain(newParameters, chi2New);
       m_parameters = newParameters;
       m_chi2 = chi2New;
       m_changes[parameterIndex] += 1;
     } else {
-      for (size_t j = 0; j < m_nParams; j++) {
-        m_chain[j].emplace_back(m_parameters.get(j));
-      }
-      m_chain[m_nParams].emplace_back(m_chi2);
+      appendToChain(m_parameters, m_chi2);
       // Old parameters taken again
       for (size_t j = 0; j < m_nParams; ++j) {
         m_fitFunction->setParameter(j, m_parameters.get(j));
@@ -668,6 +661,38 @@ bool FABADAMinimizer::iterationContinuation() {
   return false;
 }
 
+/** Add a point to the Markov chain. Unless the complete chain is output, only
+ * the points of the converged chain taken every StepsBetweenValues steps are
+ * stored, which bounds the memory used by long chains.
+ *
+ * @param parameters :: the values of the parameters at the point
+ * @param chi2 :: the chi square at the point
+ */
+void FABADAMinimizer::appendToChain(const EigenVector &parameters, double chi2) {
+  if (m_storeFullChain || (m_converged && (m_chainSize - m_convPoint) % m_stepsBetweenValues == 0)) {
+    for (size_t j = 0; j < m_nParams; j++) {
+      m_chain[j].emplace_back(parameters.get(j));
+    }
+    m_chain[m_nParams].emplace_back(chi2);
+  }
+  ++m_chainSize;
+}
+
+/** Get a point of the converged chain, thinned to one point every
+ * StepsBetweenValues steps
+ *
+ * @param parameterIndex :: the index of the parameter, or m_nParams for the chi
+ * square
+ * @param k :: the index of the point in the thinned converged chain
+ * @return :: the value of the parameter at the point
+ */
+double FABADAMinimizer::convergedChainValue(size_t parameterIndex, size_t k) const {
+  if (m_storeFullChain) {
+    return m_chain[parameterIndex][m_convPoint + m_stepsBetweenValues * k];
+  }
+  return m_chain[parameterIndex][k];
+}
+
 /** Create the workspace for the complete parameters chain (the last histogram
  *is for the Chi square).
  *
@@ -695,10 +720,8 @@ void FABADAMinimizer::outputChains() {
 /** Create the workspace containing the converged chain
  *
  * @param convLength :: length of the converged chain
- * @param nSteps :: number of steps done between chain points to avoid
- *correlation
  */
-void FABADAMinimizer::outputConvergedChains(size_t convLength, int nSteps) {
+void FABADAMinimizer::outputConvergedChains(size_t convLength) {
 
   // Create the workspace for the converged part of the chain.
   API::MatrixWorkspace_sptr wsConv;
@@ -711,14 +734,11 @@ void FABADAMinimizer::outputConvergedChains(size_t convLength, int nSteps) {
 
   // Do one iteration for each parameter plus one for Chi square.
   for (size_t j = 0; j < m_nParams + 1; ++j) {
-    std::vector<double>::const_iterator first = m_chain[j].begin() + m_convPoint;
-    std::vector<double>::const_iterator last = m_chain[j].end();
-    std::vector<double> convChain(first, last);
     auto &X = wsConv->mutableX(j);
     auto &Y = wsConv->mutableY(j);
     for (size_t k = 0; k < convLength; ++k) {
       X[k] = double(k);
-      Y[k] = convChain[nSteps * k];
+      Y[k] = convergedChainValue(j, k);
     }
   }
 
@@ -906,7 +926,6 @@ void FABADAMinimizer::outputParameterTable(const std::vector<double> &bestParame
  *and errors
  *
  * @param convLength :: length of the converged chain
- * @param nSteps :: number of steps done between chain points to avoid
  * @param reducedChain :: [output] the reduced chain
  * @param bestParameters :: [output] vector containing best values for fitting
  *parameters
@@ -915,7 +934,7 @@ void FABADAMinimizer::outputParameterTable(const std::vector<double> &bestParame
  * @param errorRight :: [output] vector containing the sqrt of the mean square
  *right deviation
  */
-void FABADAMinimizer::calculateConvChainAndBestParameters(size_t convLength, int nSteps,
+void FABADAMinimizer::calculateConvChainAndBestParameters(size_t convLength,
                                                           std::vector<std::vector<double>> &reducedChain,
                                                           std::vector<double> &bestParameters,
                                                           std::vector<double> &errorLeft,
@@ -926,13 +945,13 @@ void FABADAMinimizer::calculateConvChainAndBestParameters(size_t convLength, int
     // Write first element of the reduced chain
     for (size_t e = 0; e <= m_nParams; ++e) {
       std::vector<double> v;
-      v.emplace_back(m_chain[e][m_convPoint]);
+      v.emplace_back(convergedChainValue(e, 0));
       reducedChain.emplace_back(std::move(v));
     }
 
     // Calculate the reducedConvergedChain for the cost fuction.
     for (size_t k = 1; k < convLength; ++k) {
-      reducedChain[m_nParams].emplace_back(m_chain[m_nParams][nSteps * k + m_convPoint]);
+      reducedChain[m_nParams].emplace_back(convergedChainValue(m_nParams, k));
     }
 
     // Calculate the position of the minimum Chi square value
@@ -943,7 +962,7 @@ void FABADAMinimizer::calculateConvChainAndBestParameters(size_t convLength, int
     for (size_t j = 0; j < m_nParams; ++j) {
       // Obs: Starts at 1 (0 already added)
       for (size_t k = 1; k < convLength; ++k) {
-        reducedChain[j].emplace_back(m_chain[j][m_convPoint + nSteps * k]);
+        reducedChain[j].emplace_back(convergedChainValue(j, k));
       }
       // best fit parameters taken
       bestParameters[j] = reducedChain[j][positionMinChi2 - reducedChain[m_nParams].begin()];
@@ -971,8 +990,9 @@ void FABADAMinimizer::calculateConvChainAndBestParameters(size_t convLength, int
     g_log.warning() << "There is no converged chain."
                        " Thus the parameters' errors are not"
                        " computed.\n";
+    // The last point of the chain is the current one
     for (size_t k = 0; k < m_nParams; ++k) {
-      bestParameters[k] = *(m_chain[k].end() - 1);
+      bestParameters[k] = m_parameters.get(k);
     }
   }
 }
@@ -994,6 +1014,17 @@ void FABADAMinimizer::initChainsAndParameters() {
   size_t n = getProperty("ChainLength");
   m_chainIterations = size_t(ceil(double(n) / double(m_nParams)));
 
+  int nSteps = getProperty("StepsBetweenValues");
+  if (nSteps <= 0) {
+    g_log.warning() << "StepsBetweenValues has a non valid value"
+                       " (<= 0). Default one used"
+                       " (StepsBetweenValues = 10).\n";
+    nSteps = 10;
+  }
+  m_stepsBetweenValues = static_cast<size_t>(nSteps);
+  // The points before convergence are only needed for the complete chains
+  m_storeFullChain = !getPropertyValue("Chains").empty();
+
   // Save parameter constraints
   for (size_t i = 0; i < m_nParams; ++i) {
 
@@ -1016,12 +1047,13 @@ void FABADAMinimizer::initChainsAndParameters() {
     }
 
     // Initialize chains
-    m_chain.emplace_back(std::vector<double>(1, param));
+    m_chain.emplace_back(m_storeFullChain ? std::vector<double>(1, param) : std::vector<double>());
     // Initilize jump parameters
     m_jump.emplace_back(param != 0.0 ? std::abs(param / 10) : 0.01);
   }
   m_chi2 = m_leastSquares->val();
-  m_chain.emplace_back(std::vector<double>(1, m_chi2));
+  m_chain.emplace_back(m_storeFullChain ? std::vector<double>(1, m_chi2) : std::vector<double>());
+  m_chainSize = 1;
   m_parChanged = std::vector<bool>(m_nParams, false);
   m_changes = std::vector<int>(m_nParams, 0);
   m_changesOld = m_changes;
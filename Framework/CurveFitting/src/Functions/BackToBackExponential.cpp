@@ -144,11 +144,68 @@ void BackToBackExponential::function1D(double *out, const double *xValues, const
 }
 
 /**
- * Evaluate function derivatives numerically.
+ * Evaluate the derivatives analytically. The derivative of each term
+ * exp(arg + log(erfc(z))) has a part from erfc(z) which reduces to the same
+ * gaussian for both terms, 2/sqrt(pi) * exp(-(x-X0)^2 / (2*S^2)), so the
+ * derivatives cost little more than the values. The function depends on S
+ * only through |S|, so the derivatives are taken with respect to |S| and the
+ * one by S takes the sign of S.
+ * @param jacobian :: the Jacobian to fill
+ * @param xValues :: the x values
+ * @param nData :: the number of x values
  */
 void BackToBackExponential::functionDeriv1D(Jacobian *jacobian, const double *xValues, const size_t nData) {
-  FunctionDomain1DView domain(xValues, nData);
-  this->calNumericalDeriv(domain, *jacobian);
+  const double I = getParameter(0);
+  const double a = getParameter(1);
+  const double b = getParameter(2);
+  const double x0 = getParameter(3);
+  const double s = getParameter(4);
+
+  // the same extent as in function1D
+  double extent = expWidth();
+  if (s > extent)
+    extent = s;
+  extent *= 100;
+
+  const double s2 = s * s;
+  // function1D uses sqrt(2 * s2), which is sqrt(2) * |S|
+  const double sigma = std::sqrt(s2);
+  const double sqrt2s = std::sqrt(2 * s2);
+  double normFactor = a * b / (a + b) / 2;
+  double dNormByA = b * b / (a + b) / (a + b) / 2;
+  double dNormByB = a * a / (a + b) / (a + b) / 2;
+  if (normFactor == 0.0) {
+    normFactor = 1.0;
+    dNormByA = 0.0;
+    dNormByB = 0.0;
+  }
+  for (size_t i = 0; i < nData; i++) {
+    const double diff = xValues[i] - x0;
+    if (fabs(diff) < extent) {
+      const double z1 = (a * s2 + diff) / sqrt2s;
+      const double z2 = (b * s2 - diff) / sqrt2s;
+      const double e1 = exp(a / 2 * (a * s2 + 2 * diff) + gsl_sf_log_erfc(z1));
+      const double e2 = exp(b / 2 * (b * s2 - 2 * diff) + gsl_sf_log_erfc(z2));
+      const double gauss = M_2_SQRTPI * exp(-diff * diff / (2 * s2));
+      // derivatives of z1 and z2 with respect to |S|
+      const double dz1BySigma = a / M_SQRT2 - diff / (sqrt2s * sigma);
+      const double dz2BySigma = b / M_SQRT2 + diff / (sqrt2s * sigma);
+      const double de1ByA = e1 * (a * s2 + diff) - gauss * sigma / M_SQRT2;
+      const double de2ByB = e2 * (b * s2 - diff) - gauss * sigma / M_SQRT2;
+      // the gaussian parts cancel
+      const double dByX0 = e2 * b - e1 * a;
+      const double dBySigma = e1 * a * a * sigma + e2 * b * b * sigma - gauss * (dz1BySigma + dz2BySigma);
+      const double dByS = s < 0. ? -dBySigma : dBySigma;
+      jacobian->set(i, 0, normFactor * (e1 + e2));
+      jacobian->set(i, 1, I * (dNormByA * (e1 + e2) + normFactor * de1ByA));
+      jacobian->set(i, 2, I * (dNormByB * (e1 + e2) + normFactor * de2ByB));
+      jacobian->set(i, 3, I * normFactor * dByX0);
+      jacobian->set(i, 4, I * normFactor * dByS);
+    } else {
+      for (size_t j = 0; j < 5; ++j)
+        jacobian->set(i, j, 0.0);
+    }
+  }
 }
 
 /**
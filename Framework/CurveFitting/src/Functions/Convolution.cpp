@@ -98,21 +98,36 @@ void Convolution::setAttribute(const std::string &attName, const IFunction::Attr
   CompositeFunction::setAttribute(attName, att);
 }
 
-namespace {
-// anonymous namespace for local definitions
-
 // A struct incapsulating workspaces for real fft
-struct RealFFTWorkspace {
-  explicit RealFFTWorkspace(size_t nData)
-      : workspace(gsl_fft_real_workspace_alloc(nData)), wavetable(gsl_fft_real_wavetable_alloc(nData)) {}
-  ~RealFFTWorkspace() {
+struct Convolution::FFTWorkspace {
+  explicit FFTWorkspace(size_t nData)
+      : size(nData), workspace(gsl_fft_real_workspace_alloc(nData)), wavetable(gsl_fft_real_wavetable_alloc(nData)),
+        inverseWavetable(gsl_fft_halfcomplex_wavetable_alloc(nData)) {}
+  ~FFTWorkspace() {
+    gsl_fft_halfcomplex_wavetable_free(inverseWavetable);
     gsl_fft_real_wavetable_free(wavetable);
     gsl_fft_real_workspace_free(workspace);
   }
+  FFTWorkspace(const FFTWorkspace &) = delete;
+  FFTWorkspace &operator=(const FFTWorkspace &) = delete;
+  size_t size;
   gsl_fft_real_workspace *workspace;
   gsl_fft_real_wavetable *wavetable;
+  gsl_fft_halfcomplex_wavetable *inverseWavetable;
 };
-} // namespace
+
+/**
+ * Get the workspace for transforms of the given size. Allocating the
+ * wavetables factorises the size and tabulates the trigonometric factors, so
+ * the workspace is kept for as long as the size of the domain stays the same.
+ * @param nData :: the size of the transforms
+ * @return the workspace
+ */
+Convolution::FFTWorkspace &Convolution::fftWorkspace(const size_t nData) const {
+  if (!m_fftWorkspace || m_fftWorkspace->size != nData)
+    m_fftWorkspace = std::make_shared<FFTWorkspace>(nData);
+  return *m_fftWorkspace;
+}
 
 /**
  * Calculates convolution of the two member functions. Switches from FFT mode
@@ -168,11 +183,10 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
   const auto &d1d = dynamic_cast<const FunctionDomain1D &>(domain);
   size_t nData = domain.size();
   const double *xValues = d1d.getPointerAt(0);
-  refreshResolution();
-  RealFFTWorkspace workspace(nData);
+  auto &workspace = fftWorkspace(nData);
   int n2 = static_cast<int>(nData) / 2;
   bool odd = n2 * 2 != static_cast<int>(nData);
-  if (m_resolution.empty()) {
+  if (!resolutionIsCurrent(xValues, nData, true)) {
     m_resolution.resize(nData);
     // the resolution must be defined on interval -L < xr < L, L ==
     // (xValues[nData-1] - xValues[0]) / 2
@@ -283,9 +297,7 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
     }
 
     // Inverse fourier transform of fun
-    gsl_fft_halfcomplex_wavetable *wavetable_r = gsl_fft_halfcomplex_wavetable_alloc(nData);
-    gsl_fft_halfcomplex_inverse(out, 1, nData, wavetable_r, workspace.workspace);
-    gsl_fft_halfcomplex_wavetable_free(wavetable_r);
+    gsl_fft_halfcomplex_inverse(out, 1, nData, workspace.inverseWavetable, workspace.workspace);
 
     // Inverse fourier transform is integration - multiply by the step in the
     // integration variable
@@ -298,10 +310,8 @@ void Convolution::functionFFTMode(const FunctionDomain &domain, FunctionValues &
   if (dltF != 0.0 && !deltaShifted) {
     // If model contains any delta functions their effect is addition of scaled
     // resolution
-    std::vector<double> tmp(nData);
-    evaluateFunctionOnRange(getFunction(0), nData, xValues, tmp);
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), std::bind(std::multiplies<double>(), _1, dltF));
-    std::transform(out, out + nData, tmp.data(), out, std::plus<double>());
+    const auto &tmp = resolutionOnDomain(xValues, nData);
+    std::transform(tmp.begin(), tmp.end(), out, out, [dltF](double r, double y) { return y + dltF * r; });
   } else if (!dltFuns.empty()) {
     std::vector<double> x(nData);
     for (const auto &df : dltFuns) {
@@ -335,8 +345,6 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
                                                            // x-values
   auto ixN = nData - ixP - 1;                              // negative x-values (ixP+ixN=nData-1)
 
-  refreshResolution();
-
   // double the domain where to evaluate the convolution. Guarantees complete
   // overlap betwen convolution and signal in the original range.
   const size_t mData = nData + ixN + ixP; // equal to 2*nData-1
@@ -348,16 +356,16 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
     xValuesExtd[i] = -Dx + static_cast<double>(i) * dx;
   }
 
-  if (m_resolution.empty()) {
+  if (!resolutionIsCurrent(xValues, nData, false)) {
     m_resolution.resize(nData);
-  }
-  // Fill m_resolution with the resolution function data
-  // Lines 341-349 is duplicated in functionFFTmode. To be cleanup
-  // in issue 16064
-  evaluateFunctionOnRange(getFunction(0), nData, &xValues[0], m_resolution);
+    // Fill m_resolution with the resolution function data
+    // Lines 341-349 is duplicated in functionFFTmode. To be cleanup
+    // in issue 16064
+    evaluateFunctionOnRange(getFunction(0), nData, &xValues[0], m_resolution);
 
-  // Reverse the axis of the resolution data
-  std::reverse(m_resolution.begin(), m_resolution.end());
+    // Reverse the axis of the resolution data
+    std::reverse(m_resolution.begin(), m_resolution.end());
+  }
 
   // check for delta functions
   std::vector<std::shared_ptr<DeltaFunction>> dltFuns;
@@ -416,10 +424,8 @@ void Convolution::functionDirectMode(const FunctionDomain &domain, FunctionValue
     // resolution
     // Lines 412-430 is duplicated in functionFFTmode. To be cleanup
     // in issue 16064
-    std::vector<double> tmp(nData);
-    evaluateFunctionOnRange(getFunction(0), nData, xValues, tmp);
-    std::transform(tmp.begin(), tmp.end(), tmp.begin(), std::bind(std::multiplies<double>(), _1, dltF));
-    std::transform(out, out + nData, tmp.data(), out, std::plus<double>());
+    const auto &tmp = resolutionOnDomain(xValues, nData);
+    std::transform(tmp.begin(), tmp.end(), out, out, [dltF](double r, double y) { return y + dltF * r; });
   } else if (!dltFuns.empty()) {
     std::vector<double> x(nData);
     for (const auto &df : dltFuns) {
@@ -480,27 +486,54 @@ size_t Convolution::addFunction(IFunction_sptr f) {
  * Make sure that the resolution is updated if this function is reused in
  * several Fits.
  */
-void Convolution::setUpForFit() { m_resolution.clear(); }
+void Convolution::setUpForFit() { refreshResolution(); }
 
-/// Deletes and zeroes pointer m_resolution forsing function(...) to recalculate
-/// the resolution function
+/// Deletes the cached resolution forcing function(...) to recalculate it
 void Convolution::refreshResolution() const {
-  // refresh when calculation for the first time
-  bool needRefreshing = m_resolution.empty();
-  if (!needRefreshing) {
-    // if resolution has active parameters always refresh
-    IFunction const &res = *getFunction(0);
-    for (size_t i = 0; i < res.nParams(); ++i) {
-      if (res.isActive(i)) {
-        needRefreshing = true;
-        break;
-      }
-    }
-  }
-  if (!needRefreshing)
-    return;
-  // delete fourier transform of the resolution to force its recalculation
   m_resolution.clear();
+  m_resolutionOnDomain.clear();
+  m_resolutionKey.clear();
+}
+
+/**
+ * Check whether m_resolution was calculated for the current parameters of the
+ * resolution and for this domain. If it was not, the cache is marked as
+ * calculated for them and the caller must recalculate m_resolution.
+ * Numerical derivatives with respect to the parameters of the model, and
+ * every evaluation when the resolution is fixed, reuse the cached resolution.
+ * @param xValues :: the x values of the domain
+ * @param nData :: the size of the domain
+ * @param fftMode :: true for the transform used in FFT mode, false for the
+ * inverted resolution used in direct mode
+ * @return true if m_resolution can be used as it is
+ */
+bool Convolution::resolutionIsCurrent(const double *xValues, const size_t nData, const bool fftMode) const {
+  const auto &resolution = *getFunction(0);
+  std::vector<double> key{fftMode ? 1.0 : 0.0};
+  key.reserve(1 + resolution.nParams() + nData);
+  for (size_t i = 0; i < resolution.nParams(); ++i)
+    key.emplace_back(resolution.getParameter(i));
+  key.insert(key.end(), xValues, xValues + nData);
+  if (!m_resolution.empty() && key == m_resolutionKey)
+    return true;
+  m_resolutionKey = std::move(key);
+  m_resolutionOnDomain.clear();
+  return false;
+}
+
+/**
+ * Get the resolution evaluated on the domain, which is what delta functions
+ * at the origin add to the convolution. It is kept with m_resolution.
+ * @param xValues :: the x values of the domain
+ * @param nData :: the size of the domain
+ * @return the values of the resolution
+ */
+const std::vector<double> &Convolution::resolutionOnDomain(const double *xValues, const size_t nData) const {
+  if (m_resolutionOnDomain.size() != nData) {
+    m_resolutionOnDomain.resize(nData);
+    evaluateFunctionOnRange(getFunction(0), nData, xValues, m_resolutionOnDomain);
+  }
+  return m_resolutionOnDomain;
 }
 
 } // namespace Mantid::CurveFitting::Functions
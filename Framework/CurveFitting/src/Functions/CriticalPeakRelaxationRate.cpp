@@ -9,9 +9,26 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/CriticalPeakRelaxationRate.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidCurveFitting/AutoDiff.h"
 
 #include <cmath>
 
+namespace {
+/// The relaxation rate at a temperature, for plain values or dual numbers
+template <typename T>
+T relaxationRate(const double x, const T &scale, const T &tc, const T &exponent, const T &bg1, const T &bg2,
+                 const double delta) {
+  if (x + delta < tc || x - delta > tc) {
+    const T denom = pow(fabs(x - tc), exponent);
+    if (x < tc) {
+      return bg1 + scale / denom;
+    }
+    return bg2 + scale / denom;
+  }
+  return T(1e6);
+}
+} // namespace
+
 namespace Mantid::CurveFitting::Functions {
 
 using namespace CurveFitting;
@@ -41,16 +58,16 @@ void CriticalPeakRelaxationRate::function1D(double *out, const double *xValues,
   const double Delta = getAttribute("Delta").asDouble();
 
   for (size_t i = 0; i < nData; i++) {
-    if (xValues[i] + Delta < Tc || xValues[i] - Delta > Tc) {
-      auto denom = pow(fabs(xValues[i] - Tc), Exp);
-      if (xValues[i] < Tc) {
-        out[i] = Bg1 + Scale / denom;
-      } else {
-        out[i] = Bg2 + Scale / denom;
-      }
-    } else {
-      out[i] = 1e6;
-    }
+    out[i] = relaxationRate(xValues[i], Scale, Tc, Exp, Bg1, Bg2, Delta);
+  }
+}
+
+void CriticalPeakRelaxationRate::functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) {
+  const auto p = AutoDiff::parameters<5>(*this);
+  const double Delta = getAttribute("Delta").asDouble();
+
+  for (size_t i = 0; i < nData; i++) {
+    AutoDiff::setDerivatives(*out, i, relaxationRate(xValues[i], p[0], p[1], p[2], p[3], p[4], Delta));
   }
 }
 
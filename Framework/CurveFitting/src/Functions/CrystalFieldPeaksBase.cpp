@@ -8,6 +8,7 @@
 #include "MantidCurveFitting/Functions/CrystalElectricField.h"
 #include "MantidKernel/Exception.h"
 
+#include <algorithm>
 #include <cctype>
 #include <functional>
 #include <map>
@@ -21,6 +22,10 @@ const std::map<std::string, int> ION_2_NRE{{"Ce", 1},  {"Pr", 2},  {"Nd", 3}, {"
                                            {"Eu", 6},  {"Gd", 7},  {"Tb", 8}, {"Dy", 9}, {"Ho", 10},
                                            {"Er", 11}, {"Tm", 12}, {"Yb", 13}};
 
+/// The number of eigensystems kept. Two are enough for a numerical
+/// derivative, which returns to the unchanged field after each step.
+constexpr size_t EIGENSYSTEM_CACHE_SIZE = 2;
+
 const bool REAL_PARAM_PART = true;
 const bool IMAG_PARAM_PART = false;
 
@@ -419,7 +424,35 @@ void CrystalFieldPeaksBase::calculateEigenSystem(DoubleFortranVector &en, Comple
   bkq(6, 5) = ComplexType(B65, IB65);
   bkq(6, 6) = ComplexType(B66, IB66);
 
-  calculateEigensystem(en, wf, ham, hz, nre, bmol, bext, bkq);
+  // Fits change the peak widths and the background far more often than the
+  // field, so keep the last eigensystems with the field they were calculated for
+  std::vector<double> key{static_cast<double>(nre)};
+  for (int i = 1; i <= 3; ++i) {
+    key.emplace_back(bmol(i));
+    key.emplace_back(bext(i));
+  }
+  for (int k = 2; k <= 6; k += 2) {
+    for (int q = 0; q <= k; ++q) {
+      key.emplace_back(bkq(k, q).real());
+      key.emplace_back(bkq(k, q).imag());
+    }
+  }
+  auto cached = std::find_if(m_eigenSystems.begin(), m_eigenSystems.end(),
+                             [&key](const EigenSystem &system) { return system.key == key; });
+  if (cached == m_eigenSystems.end()) {
+    calculateEigensystem(en, wf, ham, hz, nre, bmol, bext, bkq);
+    if (m_eigenSystems.size() == EIGENSYSTEM_CACHE_SIZE)
+      m_eigenSystems.pop_back();
+    m_eigenSystems.insert(m_eigenSystems.begin(), EigenSystem{std::move(key), en, wf, ham, hz});
+  } else {
+    // the most recently used system goes first
+    std::rotate(m_eigenSystems.begin(), cached, cached + 1);
+    const auto &system = m_eigenSystems.front();
+    en = system.energies;
+    wf = system.waveFunctions;
+    ham = system.hamiltonian;
+    hz = system.hamiltonianZeeman;
+  }
   // MaxPeakCount is a read-only "mutable" attribute.
   const_cast<CrystalFieldPeaksBase *>(this)->setAttributeValue("MaxPeakCount", static_cast<int>(en.size()));
 }
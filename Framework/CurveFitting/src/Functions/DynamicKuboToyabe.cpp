@@ -34,13 +34,11 @@ void DynamicKuboToyabe::init() {
 //--------------------------------------------------------------------------------------------------------------------------------------
 // From Numerical Recipes
 
-// Midpoint method
+// Midpoint method. s holds the estimate of the previous refinement stage.
 double midpnt(double func(const double, const double, const double), const double a, const double b, const int n,
-              const double g, const double w0) {
+              const double g, const double w0, double &s) {
   // quote & modified from numerical recipe 2nd edtion (page147)
 
-  static double s;
-
   if (n == 1) {
     s = (b - a) * func(0.5 * (a + b), g, w0);
     return (s);
@@ -111,10 +109,11 @@ double integral(double func(const double, const double, const double), const dou
   int j;
   double ss, dss;
   double h[JMAXP + 1], s[JMAXP];
+  double midpoint = 0.0;
 
   h[1] = 1.0;
   for (j = 1; j <= JMAX; j++) {
-    s[j] = midpnt(func, a, b, j, g, w0);
+    s[j] = midpnt(func, a, b, j, g, w0, midpoint);
     if (j >= K) {
       polint(&h[j - K], &s[j - K], K, 0.0, ss, dss);
       if (fabs(dss) <= fabs(ss))
@@ -187,52 +186,54 @@ double DynamicKuboToyabe::getDKT(double t, double G, double F, double v, double
 
   const auto tsmax = static_cast<int>(std::ceil(32.768 / eps));
 
-  static double oldG = -1., oldV = -1., oldF = -1., oldEps = -1.;
-
-  const auto maxTsmax = static_cast<int>(std::ceil(32.768 / m_minEps));
-  static std::vector<double> gStat(maxTsmax), gDyn(maxTsmax);
+  // The tables are cached per instance so that separate functions can be evaluated concurrently
+  if (m_gStat.empty()) {
+    const auto maxTsmax = static_cast<size_t>(std::ceil(32.768 / m_minEps));
+    m_gStat.resize(maxTsmax);
+    m_gDyn.resize(maxTsmax);
+  }
 
-  if ((G != oldG) || (v != oldV) || (F != oldF) || (eps != oldEps)) {
+  if ((G != m_oldG) || (v != m_oldV) || (F != m_oldF) || (eps != m_oldEps)) {
 
     // If G or v or F or eps have changed with respect to the
     // previous call, we need to re-do the computations
 
-    if (G != oldG || (F != oldF)) {
+    if (G != m_oldG || (F != m_oldF)) {
 
       // But we only need to
-      // re-compute gStat if G or F have changed
+      // re-compute m_gStat if G or F have changed
 
       // Generate static Kubo-Toyabe
       if (F == 0) {
         for (int k = 0; k < tsmax; k++) {
-          gStat[k] = ZFKT(k * eps, G);
+          m_gStat[k] = ZFKT(k * eps, G);
         }
       } else {
         for (int k = 0; k < tsmax; k++) {
-          gStat[k] = HKT(k * eps, G, F);
+          m_gStat[k] = HKT(k * eps, G, F);
         }
       }
       // Store new G value
-      oldG = G;
+      m_oldG = G;
       // Store new F value
-      oldF = F;
+      m_oldF = F;
     }
 
     // Store new v value
-    oldV = v;
+    m_oldV = v;
     // Store new eps value
-    oldEps = eps;
+    m_oldEps = eps;
 
     double hop = v * eps;
 
     // Generate dynamic Kubo Toyabe
     for (int k = 0; k < tsmax; k++) {
-      double y = gStat[k];
+      double y = m_gStat[k];
       // do integration
       for (int j = k - 1; j > 0; j--) {
-        y = y * (1 - hop) + hop * gDyn[k - j] * gStat[j];
+        y = y * (1 - hop) + hop * m_gDyn[k - j] * m_gStat[j];
       }
-      gDyn[k] = y;
+      m_gDyn[k] = y;
     }
   }
 
@@ -242,7 +243,7 @@ double DynamicKuboToyabe::getDKT(double t, double G, double F, double v, double
   if (x > tsmax - 2)
     x = tsmax - 2;
   double xe = (fabs(t) / eps) - x;
-  return gDyn[x] * (1 - xe) + xe * gDyn[x + 1];
+  return m_gDyn[x] * (1 - xe) + xe * m_gDyn[x + 1];
 }
 
 // Dynamic Kubo Toyabe function
@@ -281,7 +282,8 @@ void DynamicKuboToyabe::function1D(double *out, const double *xValues, const siz
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
-DynamicKuboToyabe::DynamicKuboToyabe() : m_eps(0.05), m_minEps(0.001), m_maxEps(0.1) {}
+DynamicKuboToyabe::DynamicKuboToyabe()
+    : m_eps(0.05), m_minEps(0.001), m_maxEps(0.1), m_oldG(-1.), m_oldV(-1.), m_oldF(-1.), m_oldEps(-1.) {}
 
 //----------------------------------------------------------------------------------------------
 /** Function to calculate derivative numerically
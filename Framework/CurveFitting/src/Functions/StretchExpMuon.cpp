@@ -9,8 +9,16 @@
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/StretchExpMuon.h"
 #include "MantidAPI/FunctionFactory.h"
+#include "MantidCurveFitting/AutoDiff.h"
 #include <cmath>
 
+namespace {
+/// A * exp(-(Lambda * x)^Beta) for plain values or dual numbers
+template <typename T> T stretchedExponential(const double x, const T &A, const T &lambda, const T &beta) {
+  return A * exp(-pow(lambda * x, beta));
+}
+} // namespace
+
 namespace Mantid::CurveFitting::Functions {
 
 using namespace CurveFitting;
@@ -33,7 +41,14 @@ void StretchExpMuon::function1D(double *out, const double *xValues, const size_t
   const double b = getParameter("Beta");
 
   for (size_t i = 0; i < nData; i++) {
-    out[i] = A * exp(-pow(G * xValues[i], b));
+    out[i] = stretchedExponential(xValues[i], A, G, b);
+  }
+}
+
+void StretchExpMuon::functionDeriv1D(API::Jacobian *out, const double *xValues, const size_t nData) {
+  const auto p = AutoDiff::parameters<3>(*this);
+  for (size_t i = 0; i < nData; i++) {
+    AutoDiff::setDerivatives(*out, i, stretchedExponential(xValues[i], p[0], p[1], p[2]));
   }
 }
 
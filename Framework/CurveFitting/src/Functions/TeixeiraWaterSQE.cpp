@@ -8,13 +8,40 @@
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/IFunction.h"
 #include "MantidAPI/Jacobian.h"
+#include "MantidCurveFitting/AutoDiff.h"
 #include <cmath>
 #include <limits>
 
 namespace {
 Mantid::Kernel::Logger g_log("TeixeiraWaterSQE");
+
+const double hbar(0.658211626); // ps*meV
+
+/**
+ * HWHM of the Lorentzian, for plain values or dual numbers
+ * @param diffCoeff :: diffusion coefficient in 10^(-5)cm^2/s
+ * @param tau :: residence time in ps
+ * @param Q :: momentum transfer
+ */
+template <typename T> T halfWidth(const T &diffCoeff, const T &tau, const double Q) {
+  // conversion from 10^{-5}cm^2/s to Angstrom^2/ps, the internal units used
+  const T D = diffCoeff * 0.10;
+  return hbar * D * Q * Q / (1.0 + D * Q * Q * tau);
 }
 
+/// Negative or zero parameters are penalized, in case they show up when calculating numeric derivatives
+bool isPenalized(const double height, const double diffCoeff, const double tau) {
+  return height < std::numeric_limits<double>::epsilon() || diffCoeff < std::numeric_limits<double>::epsilon() ||
+         tau < std::numeric_limits<double>::epsilon();
+}
+
+/// The Lorentzian at an energy, for plain values or dual numbers
+template <typename T> T lorentzian(const double energy, const T &height, const T &halfWidth, const T &centre) {
+  const T E = energy - centre;
+  return height * halfWidth / (halfWidth * halfWidth + E * E) / M_PI;
+}
+} // namespace
+
 namespace Mantid::CurveFitting::Functions {
 
 DECLARE_FUNCTION(TeixeiraWaterSQE)
@@ -36,17 +63,13 @@ void TeixeiraWaterSQE::declareParameters() {
  * @param nData size of the energy domain
  */
 void TeixeiraWaterSQE::function1D(double *out, const double *xValues, const size_t nData) const {
-  double hbar(0.658211626); // ps*meV
   auto H = this->getParameter("Height");
   auto D = this->getParameter("DiffCoeff");
   auto T = this->getParameter("Tau");
   auto C = this->getParameter("Centre");
   auto Q = this->getAttribute("Q").asDouble();
 
-  // Penalize negative parameters, just in case they show up
-  // when calculating the numeric derivative
-  if (H < std::numeric_limits<double>::epsilon() || D < std::numeric_limits<double>::epsilon() ||
-      T < std::numeric_limits<double>::epsilon()) {
+  if (isPenalized(H, D, T)) {
     for (size_t j = 0; j < nData; j++) {
       out[j] = std::numeric_limits<double>::infinity();
     }
@@ -54,60 +77,30 @@ void TeixeiraWaterSQE::function1D(double *out, const double *xValues, const size
   }
 
   // Lorentzian intensities and HWHM
-  D *= 0.10; // conversion from 10^{-5}cm^2/s to Angstrom^2/ps, the internal
-             // units used
-  auto G = hbar * D * Q * Q / (1 + D * Q * Q * T);
+  auto G = halfWidth(D, T, Q);
   for (size_t j = 0; j < nData; j++) {
-    auto E = xValues[j] - C;
-    out[j] += H * G / (G * G + E * E) / M_PI;
+    out[j] += lorentzian(xValues[j], H, G, C);
   }
 }
 
 /**
- * @brief analytical/numerical derivative with respect to fitting parameters
- * We carry out analytical derivative for parameter Height and numerical
- * derivatives for parameters
- * DiffCoeff, Tau, and Centre, selecting sensible steps.
+ * @brief exact derivatives with respect to all fitting parameters, calculated
+ * in one pass by automatic differentiation of the same formula as function1D.
+ * Where function1D returns its constant penalty the derivatives are zero.
  */
 void TeixeiraWaterSQE::functionDeriv1D(Mantid::API::Jacobian *jacobian, const double *xValues, const size_t nData) {
-  const double deltaF{0.1}; // increase parameter by this fraction
-  const size_t nParam = this->nParams();
-  // cutoff defines the smallest change in the parameter when calculating the
-  // numerical derivative
-  std::map<std::string, double> cutoff;
-  cutoff["DiffCoeff"] = 0.2; // 0.2x10^(-5)cm^2/s
-  cutoff["Tau"] = 0.2;       // 0.2ps
-  cutoff["Centre"] = 0.0001; // 0.1micro-eV
-  std::vector<double> out(nData);
-  this->applyTies();
-  this->function1D(out.data(), xValues, nData);
-
-  for (size_t iP = 0; iP < nParam; iP++) {
-    if (this->isActive(iP)) {
-      std::vector<double> derivative(nData);
-      const double pVal = this->activeParameter(iP);
-      const std::string pName = this->parameterName(iP);
-      if (pName == "Height") {
-        // exact derivative
-        this->setActiveParameter(iP, 1.0);
-        this->applyTies();
-        this->function1D(derivative.data(), xValues, nData);
-      } else {
-        // numerical derivative
-        double delta = cutoff[pName] > fabs(pVal * deltaF) ? cutoff[pName] : pVal * deltaF;
-        this->setActiveParameter(iP, pVal + delta);
-        this->applyTies();
-        this->function1D(derivative.data(), xValues, nData);
-        for (size_t i = 0; i < nData; i++) {
-          derivative[i] = (derivative[i] - out[i]) / delta;
-        }
-      }
-      this->setActiveParameter(iP, pVal); // restore the value of the parameter
-      // fill the jacobian for this parameter
-      for (size_t i = 0; i < nData; i++) {
-        jacobian->set(i, iP, derivative[i]);
-      }
+  const auto p = AutoDiff::parameters<4>(*this);
+  if (isPenalized(p[0].value(), p[1].value(), p[2].value())) {
+    for (size_t j = 0; j < nData; j++) {
+      for (size_t i = 0; i < nParams(); i++)
+        jacobian->set(j, i, 0.0);
     }
+    return;
+  }
+  const auto Q = this->getAttribute("Q").asDouble();
+  const auto G = halfWidth(p[1], p[2], Q);
+  for (size_t j = 0; j < nData; j++) {
+    AutoDiff::setDerivatives(*jacobian, j, lorentzian(xValues[j], p[0], G, p[3]));
   }
 }
 
@@ -8,6 +8,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidCurveFitting/Functions/UserFunction.h"
+#include "MantidAPI/CompiledFormula.h"
 #include "MantidAPI/FunctionFactory.h"
 #include "MantidAPI/MuParserUtils.h"
 #include "MantidGeometry/muParser_Silent.h"
@@ -68,6 +69,7 @@ void UserFunction::setAttribute(const std::string &attName, const Attribute &val
   }
 
   m_x_set = false;
+  m_compiled.reset();
   clearAllParameters();
 
   try {
@@ -98,6 +100,16 @@ void UserFunction::setAttribute(const std::string &attName, const Attribute &val
   }
 
   m_parser->SetExpr(m_formula);
+
+  std::vector<std::string> names;
+  for (size_t i = 0; i < nParams(); i++) {
+    names.emplace_back(parameterName(i));
+  }
+  try {
+    m_compiled = std::make_unique<CompiledFormula>(m_formula, "x", names);
+  } catch (std::invalid_argument &) {
+    // Evaluate the formula with m_parser
+  }
 }
 
 /** Calculate the fitting function.
@@ -111,6 +123,10 @@ void UserFunction::function1D(double *out, const double *xValues, const size_t n
   if (m_formula.empty()) {
     throw std::invalid_argument("Empty formula supplied for user function");
   }
+  if (m_compiled) {
+    m_compiled->evaluate(xValues, nData, parameterValues().data(), out);
+    return;
+  }
   for (size_t i = 0; i < nData; i++) {
     m_x = xValues[i];
     try {
@@ -123,12 +139,53 @@ void UserFunction::function1D(double *out, const double *xValues, const size_t n
 }
 
 /**
+ * Calculate the derivatives analytically if the formula is compiled, and
+ * numerically otherwise. Tied parameters also need the numerical derivatives,
+ * which follow the ties of the other parameters through applyTies().
  * @param domain :: the space on which the function acts
  * @param jacobian :: the set of partial derivatives of the function with
  * respect to the fitting parameters
  */
 void UserFunction::functionDeriv(const API::FunctionDomain &domain, API::Jacobian &jacobian) {
-  calNumericalDeriv(domain, jacobian);
+  const auto *domain1D = dynamic_cast<const FunctionDomain1D *>(&domain);
+  if (!m_compiled || !domain1D || domain1D->size() == 0 || hasTiedParameters()) {
+    calNumericalDeriv(domain, jacobian);
+    return;
+  }
+  const size_t nData = domain1D->size();
+  std::vector<std::vector<double>> derivatives(nParams(), std::vector<double>(nData));
+  std::vector<double *> buffers;
+  for (auto &derivative : derivatives) {
+    buffers.emplace_back(derivative.data());
+  }
+  m_compiled->evaluateDerivatives(domain1D->getPointerAt(0), nData, parameterValues().data(), buffers);
+  for (size_t j = 0; j < derivatives.size(); j++) {
+    for (size_t i = 0; i < nData; i++) {
+      jacobian.set(i, j, derivatives[j][i]);
+    }
+  }
+}
+
+/// @return true if any parameter is tied to the others
+bool UserFunction::hasTiedParameters() const {
+  for (size_t i = 0; i < nParams(); i++) {
+    if (getParameterStatus(i) == Tied) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * @return the values of the parameters in the order they are declared, which
+ * is the order of the scalar variables of the compiled formula
+ */
+std::vector<double> UserFunction::parameterValues() const {
+  std::vector<double> values(nParams());
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = getParameter(i);
+  }
+  return values;
 }
 
 } // namespace Mantid::CurveFitting::Functions
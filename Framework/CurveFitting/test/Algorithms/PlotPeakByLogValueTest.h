@@ -166,6 +166,43 @@ public:
     WorkspaceCreationHelper::removeWS("PlotPeakResult");
   }
 
+  void test_individual_fits_match_the_data_and_are_in_order() {
+    createData();
+
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PlotPeakGroup_2,i1;PlotPeakGroup_0,i1;PlotPeakGroup_1,i1");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+    alg.setPropertyValue("LogValue", "SourceName");
+    alg.setPropertyValue("FitType", "Individual");
+    alg.setPropertyValue("Function", "name=LinearBackground,A0=1,A1=0.3;name="
+                                     "Gaussian,PeakCentre=5,Height=2,Sigma=0.1");
+    alg.setProperty("OutputFitStatus", true);
+    alg.execute();
+    TS_ASSERT(alg.isExecuted());
+
+    TWS_type result = WorkspaceCreationHelper::getWS<TableWorkspace>("PlotPeakResult");
+    TS_ASSERT_EQUALS(result->rowCount(), 3);
+    const std::vector<int> workspaces{2, 0, 1};
+    for (size_t row = 0; row < workspaces.size(); ++row) {
+      const int i = workspaces[row];
+      TS_ASSERT_EQUALS(result->String(row, 0), "PlotPeakGroup_" + std::to_string(i));
+      TS_ASSERT_DELTA(result->Double(row, 1), 1. + 0.1 * i, 1e-10);
+      TS_ASSERT_DELTA(result->Double(row, 3), 0.3 - 0.02 * i, 1e-10);
+      TS_ASSERT_DELTA(result->Double(row, 5), 2. - 0.2 * i, 1e-10);
+      TS_ASSERT_DELTA(result->Double(row, 7), 5. + 0.03 * i, 1e-10);
+      TS_ASSERT_DELTA(result->Double(row, 9), 0.1 + 0.01 * i, 1e-10);
+    }
+    const std::vector<double> chiSquared = alg.getProperty("OutputChiSquared");
+    TS_ASSERT_EQUALS(chiSquared.size(), 3);
+    // The function holds the results of the last fit
+    IFunction_sptr function = alg.getProperty("Function");
+    TS_ASSERT_DELTA(function->getParameter("f1.PeakCentre"), 5.03, 1e-10);
+
+    deleteData();
+    WorkspaceCreationHelper::removeWS("PlotPeakResult");
+  }
+
   void testWorkspaceList() {
     createData();
 
@@ -721,6 +758,47 @@ public:
     AnalysisDataService::Instance().clear();
   }
 
+  void test_individual_FABADA_fits_of_several_spectra() {
+    auto ws = WorkspaceFactory::Instance().create("Workspace2D", 3, 20, 20);
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      auto &x = ws->mutableX(i);
+      auto &y = ws->mutableY(i);
+      for (size_t j = 0; j < x.size(); ++j) {
+        x[j] = 0.1 * double(j);
+        y[j] = 10.0 * exp(-x[j] / 0.5);
+      }
+      ws->mutableE(i) = 1.0;
+    }
+    AnalysisDataService::Instance().addOrReplace("PlotPeakFABADA", ws);
+
+    PlotPeakByLogValue alg;
+    alg.initialize();
+    alg.setPropertyValue("Input", "PlotPeakFABADA,i0;PlotPeakFABADA,i1;PlotPeakFABADA,i2");
+    alg.setPropertyValue("OutputWorkspace", "PlotPeakResult");
+    alg.setPropertyValue("FitType", "Individual");
+    alg.setPropertyValue("Function", "name=ExpDecay,Height=8,Lifetime=1");
+    alg.setPropertyValue("MaxIterations", "100000");
+    alg.setPropertyValue("Minimizer", "FABADA,ChainLength=5000,StepsBetweenValues=10,ConvergenceCriteria=0.1,Seed=11,"
+                                      "PDF=PlotPeakFABADA_PDF");
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    // The same data fitted with the same seed takes the same steps
+    TWS_type result = WorkspaceCreationHelper::getWS<TableWorkspace>("PlotPeakResult");
+    TS_ASSERT_EQUALS(result->rowCount(), 3);
+    for (size_t row = 0; row < result->rowCount(); ++row) {
+      TS_ASSERT_DELTA(result->Double(row, 1), 10.0, 0.1);
+      TS_ASSERT_DELTA(result->Double(row, 3), 0.5, 0.01);
+      for (size_t column = 1; column < result->columnCount(); ++column) {
+        TS_ASSERT_EQUALS(result->Double(row, column), result->Double(0, column));
+      }
+    }
+    const auto pdf = AnalysisDataService::Instance().retrieveWS<WorkspaceGroup>("PlotPeakFABADA_PDF");
+    TS_ASSERT_EQUALS(pdf->size(), 3);
+
+    AnalysisDataService::Instance().clear();
+  }
+
   void test_parameters_are_correct_for_a_histogram_fit() {
     createHistogramWorkspace("InputWS", 10, -10.0, 10.0);
 
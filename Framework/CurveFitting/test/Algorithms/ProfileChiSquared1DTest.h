@@ -10,8 +10,12 @@
 
 #include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/IFunction.h"
 #include "MantidCurveFitting/Algorithms/ProfileChiSquared1D.h"
+#include "MantidCurveFitting/Functions/LinearBackground.h"
 #include "MantidDataObjects/TableWorkspace.h"
+#include "MantidKernel/Exception.h"
 
 using Mantid::CurveFitting::Algorithms::ProfileChiSquared1D;
 using namespace Mantid;
@@ -23,6 +27,25 @@ constexpr const char *linearFunctionString = "name = LinearBackground, A0=0.8753
                                              "2.026706319695708 ";
 }
 
+/// A linear background that, once one of its parameters is fixed, reports a
+/// change of its parameters in the middle of the first fit iteration
+class ProfileChiSquared1DTest_ResizingLinear : public Mantid::CurveFitting::Functions::LinearBackground {
+public:
+  std::string name() const override { return "ProfileChiSquared1DTest_ResizingLinear"; }
+  void functionDeriv1D(Jacobian *out, const double *xValues, const size_t nData) override {
+    if (!m_resized && (isFixed(0) || isFixed(1))) {
+      m_resized = true;
+      throw Mantid::Kernel::Exception::FitSizeWarning(nParams());
+    }
+    LinearBackground::functionDeriv1D(out, xValues, nData);
+  }
+
+private:
+  bool m_resized{false};
+};
+
+DECLARE_FUNCTION(ProfileChiSquared1DTest_ResizingLinear)
+
 class ProfileChiSquared1DTest : public CxxTest::TestSuite {
 public:
   static ProfileChiSquared1DTest *createSuite() { return new ProfileChiSquared1DTest(); }
@@ -38,11 +61,11 @@ public:
     algo->execute();
   }
 
-  void executeAlgorithmOnLinearData(const std::string &outputName) {
+  void executeAlgorithmOnLinearData(const std::string &outputName,
+                                    const std::string &functionString = linearFunctionString) {
     std::string wsName = "ProfileChiSquared1DData_linear";
     loadLinearData(wsName);
     auto ws = AnalysisDataService::Instance().retrieveWS<Workspace>(wsName);
-    auto functionString = std::string(linearFunctionString);
     auto profileAlg = ProfileChiSquared1D();
     profileAlg.initialize();
     profileAlg.setProperty("Function", functionString);
@@ -135,6 +158,58 @@ public:
     AnalysisDataService::Instance().clear();
   }
 
+  // the chi squared of a model linear in its parameters is quadratic, so
+  // the profiled errors of every parameter must match the quadratic ones
+  void test_errors_for_quadratic_function_match_quadratic_errors() {
+    std::string wsName = "ProfileChiSquared1DData_linear";
+    loadLinearData(wsName);
+    auto ws = AnalysisDataService::Instance().retrieveWS<Workspace>(wsName);
+    auto fit = AlgorithmManager::Instance().create("Fit");
+    fit->setChild(true);
+    fit->setPropertyValue("Function", "name = Quadratic, A0 = 1, A1 = 2, A2 = 0");
+    fit->setProperty("InputWorkspace", ws);
+    fit->execute();
+    IFunction_sptr function = fit->getProperty("Function");
+
+    auto profileAlg = ProfileChiSquared1D();
+    profileAlg.initialize();
+    profileAlg.setProperty("Function", function);
+    profileAlg.setProperty("InputWorkspace", ws);
+    profileAlg.setProperty("Output", "OutputName5");
+    profileAlg.execute();
+    TableWorkspace_sptr errorsTable;
+    TS_ASSERT_THROWS_NOTHING(errorsTable =
+                                 AnalysisDataService::Instance().retrieveWS<TableWorkspace>("OutputName5_errors"));
+    TS_ASSERT_EQUALS(errorsTable->rowCount(), 3);
+    for (size_t row = 0; row < 3; ++row) {
+      const double error = errorsTable->Double(row, 9);
+      TS_ASSERT_DELTA(errorsTable->Double(row, 3), -error, 1e-4 * error);
+      TS_ASSERT_DELTA(errorsTable->Double(row, 4), error, 1e-4 * error);
+      TS_ASSERT_DELTA(errorsTable->Double(row, 8), 3 * error, 1e-4 * error);
+    }
+    AnalysisDataService::Instance().clear();
+  }
+
+  void test_fits_recover_when_the_function_changes_its_parameters() {
+    executeAlgorithmOnLinearData("OutputName6");
+    auto resizingFunction = std::string(linearFunctionString);
+    resizingFunction.replace(resizingFunction.find("LinearBackground"), std::string("LinearBackground").size(),
+                             "ProfileChiSquared1DTest_ResizingLinear");
+    executeAlgorithmOnLinearData("OutputName7", resizingFunction);
+    TableWorkspace_sptr expected, errorsTable;
+    TS_ASSERT_THROWS_NOTHING(expected =
+                                 AnalysisDataService::Instance().retrieveWS<TableWorkspace>("OutputName6_errors"));
+    TS_ASSERT_THROWS_NOTHING(errorsTable =
+                                 AnalysisDataService::Instance().retrieveWS<TableWorkspace>("OutputName7_errors"));
+    TS_ASSERT_EQUALS(errorsTable->rowCount(), 2);
+    for (size_t row = 0; row < 2; ++row) {
+      for (size_t col = 1; col < 10; ++col) {
+        TS_ASSERT_DELTA(errorsTable->Double(row, col), expected->Double(row, col), 1e-6);
+      }
+    }
+    AnalysisDataService::Instance().clear();
+  }
+
   void test_errors_table_has_correct_shape() {
     executeAlgorithmOnLinearData("OutputName3");
     TableWorkspace_sptr errorsTable;
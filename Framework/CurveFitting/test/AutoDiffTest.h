@@ -0,0 +1,72 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidCurveFitting/AutoDiff.h"
+
+#include <cmath>
+
+using Mantid::CurveFitting::AutoDiff::Dual;
+
+class AutoDiffTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static AutoDiffTest *createSuite() { return new AutoDiffTest(); }
+  static void destroySuite(AutoDiffTest *suite) { delete suite; }
+
+  void test_constants_have_no_derivatives() {
+    const Dual<2> c(3.0);
+    TS_ASSERT_EQUALS(c.value(), 3.0);
+    TS_ASSERT_EQUALS(c.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(c.derivative(1), 0.0);
+  }
+
+  void test_arithmetic() {
+    const auto x = Dual<2>::variable(2.0, 0);
+    const auto y = Dual<2>::variable(5.0, 1);
+    const auto f = (x * y + 3.0 * x - y / x) / (1.0 - y);
+    // f = (x y + 3 x - y / x) / (1 - y)
+    const double numerator = 2.0 * 5.0 + 6.0 - 2.5;
+    TS_ASSERT_DELTA(f.value(), numerator / -4.0, 1e-12);
+    TS_ASSERT_DELTA(f.derivative(0), (5.0 + 3.0 + 5.0 / 4.0) / -4.0, 1e-12);
+    TS_ASSERT_DELTA(f.derivative(1), (2.0 - 0.5) / -4.0 + numerator / 16.0, 1e-12);
+  }
+
+  void test_elementary_functions() {
+    const auto x = Dual<1>::variable(0.7, 0);
+    TS_ASSERT_DELTA(exp(x).derivative(0), std::exp(0.7), 1e-12);
+    TS_ASSERT_DELTA(log(x).derivative(0), 1.0 / 0.7, 1e-12);
+    TS_ASSERT_DELTA(sqrt(x).derivative(0), 0.5 / std::sqrt(0.7), 1e-12);
+    TS_ASSERT_DELTA(sin(x).derivative(0), std::cos(0.7), 1e-12);
+    TS_ASSERT_DELTA(cos(x).derivative(0), -std::sin(0.7), 1e-12);
+    TS_ASSERT_DELTA(fabs(-x).derivative(0), 1.0, 1e-12);
+    TS_ASSERT_DELTA(erfc(x).derivative(0), -2.0 / std::sqrt(M_PI) * std::exp(-0.49), 1e-12);
+    TS_ASSERT_DELTA(pow(x, 2.5).derivative(0), 2.5 * std::pow(0.7, 1.5), 1e-12);
+  }
+
+  void test_pow_with_variable_exponent() {
+    const auto x = Dual<2>::variable(1.5, 0);
+    const auto a = Dual<2>::variable(0.5, 1);
+    const auto f = pow(x, a);
+    TS_ASSERT_DELTA(f.value(), std::pow(1.5, 0.5), 1e-12);
+    TS_ASSERT_DELTA(f.derivative(0), 0.5 * std::pow(1.5, -0.5), 1e-12);
+    TS_ASSERT_DELTA(f.derivative(1), std::pow(1.5, 0.5) * std::log(1.5), 1e-12);
+  }
+
+  void test_pow_of_zero_has_finite_derivatives() {
+    // as in (lambda * x)^beta at x = 0
+    const auto lambda = Dual<2>::variable(2.0, 0);
+    const auto beta = Dual<2>::variable(0.5, 1);
+    const auto f = pow(lambda * 0.0, beta);
+    TS_ASSERT_EQUALS(f.value(), 0.0);
+    TS_ASSERT_EQUALS(f.derivative(0), 0.0);
+    TS_ASSERT_EQUALS(f.derivative(1), 0.0);
+  }
+};
@@ -19,6 +19,7 @@
 #include "MantidCurveFitting/Functions/ExpDecay.h"
 #include "MantidCurveFitting/Functions/Gaussian.h"
 #include "MantidCurveFitting/Functions/LinearBackground.h"
+#include "MantidCurveFitting/Functions/Quadratic.h"
 #include "MantidCurveFitting/Functions/UserFunction.h"
 #include "MantidCurveFitting/GSLFunctions.h"
 
@@ -208,6 +209,100 @@ public:
     TS_ASSERT_DELTA(L, -0.145, 1e-10); // L + costFun->val() == 0
   }
 
+  void test_derivatives_and_hessian_with_weights_and_fixed_parameter() {
+    const std::vector<double> x{0.0, 0.5, 1.0, 1.5, 2.0}, y{1.0, 2.0, 2.5, 4.0, 7.0}, w{1.0, 2.0, 0.5, 1.5, 1.0};
+    API::FunctionDomain1D_sptr domain(new API::FunctionDomain1DVector(x));
+    API::FunctionValues_sptr values(new API::FunctionValues(*domain));
+    values->setFitData(y);
+    values->setFitWeights(w);
+
+    auto fun = std::make_shared<Quadratic>();
+    fun->initialize();
+    fun->setParameter("A0", 0.5);
+    fun->setParameter("A1", 1.0);
+    fun->setParameter("A2", 1.2);
+    fun->fix(1);
+
+    auto costFun = std::make_shared<CostFuncLeastSquares>();
+    costFun->setFittingFunction(fun, domain, values);
+    TS_ASSERT_EQUALS(costFun->nParams(), 2);
+
+    // only A0 and A2 are active, with derivatives 1 and x^2
+    double val(0.0), der0(0.0), der1(0.0), h00(0.0), h01(0.0), h11(0.0);
+    for (size_t i = 0; i < x.size(); ++i) {
+      const double x2 = x[i] * x[i];
+      const double w2 = w[i] * w[i];
+      const double r = 0.5 + x[i] + 1.2 * x2 - y[i];
+      val += 0.5 * r * r * w2;
+      der0 += r * w2;
+      der1 += r * w2 * x2;
+      h00 += w2;
+      h01 += w2 * x2;
+      h11 += w2 * x2 * x2;
+    }
+    TS_ASSERT_DELTA(costFun->valDerivHessian(), val, 1e-10);
+    const EigenVector &der = costFun->getDeriv();
+    TS_ASSERT_DELTA(der.get(0), der0, 1e-10);
+    TS_ASSERT_DELTA(der.get(1), der1, 1e-10);
+    const EigenMatrix &hessian = costFun->getHessian();
+    TS_ASSERT_DELTA(hessian.get(0, 0), h00, 1e-10);
+    TS_ASSERT_DELTA(hessian.get(0, 1), h01, 1e-10);
+    TS_ASSERT_DELTA(hessian.get(1, 0), h01, 1e-10);
+    TS_ASSERT_DELTA(hessian.get(1, 1), h11, 1e-10);
+  }
+
+  void test_reused_member_values_follow_the_parameters() {
+    std::vector<double> x(30), y(30);
+    for (size_t i = 0; i < x.size(); ++i) {
+      x[i] = 0.1 * double(i);
+      y[i] = 1.0 + 0.5 * x[i] + 2.0 * exp(-0.5 * (x[i] - 1.5) * (x[i] - 1.5) / 0.09);
+    }
+    API::FunctionDomain1D_sptr domain(new API::FunctionDomain1DVector(x));
+    API::FunctionValues_sptr values(new API::FunctionValues(*domain));
+    values->setFitData(y);
+    values->setFitWeights(1.0);
+
+    auto bk = std::make_shared<LinearBackground>();
+    bk->initialize();
+    bk->setParameter("A0", 0.8);
+    bk->setParameter("A1", 0.4);
+    auto fn = std::make_shared<Gaussian>();
+    fn->initialize();
+    fn->setParameter("PeakCentre", 1.4);
+    fn->setParameter("Height", 1.5);
+    fn->setParameter("Sigma", 0.25);
+    auto fnWithBk = std::make_shared<API::CompositeFunction>();
+    fnWithBk->addFunction(bk);
+    fnWithBk->addFunction(fn);
+
+    auto reusing = std::make_shared<CostFuncLeastSquares>();
+    reusing->setFittingFunction(fnWithBk, domain, values);
+    reusing->setReuseMemberValues(true);
+    auto plain = std::make_shared<CostFuncLeastSquares>();
+    plain->setFittingFunction(fnWithBk, domain, std::make_shared<API::FunctionValues>(*values));
+
+    TS_ASSERT_DELTA(reusing->val(), plain->val(), 1e-10);
+    // change one parameter at a time, as Monte Carlo minimizers do
+    for (size_t i = 0; i < reusing->nParams(); ++i) {
+      const double p = reusing->getParameter(i) * 1.1 + 0.01;
+      reusing->setParameter(i, p);
+      plain->setParameter(i, p);
+      TS_ASSERT_DELTA(reusing->val(), plain->val(), 1e-10);
+    }
+
+    // the kept values were calculated on the old domain
+    std::vector<double> shifted(x.size());
+    for (size_t i = 0; i < x.size(); ++i)
+      shifted[i] = x[i] + 0.05;
+    API::FunctionDomain1D_sptr newDomain(new API::FunctionDomain1DVector(shifted));
+    API::FunctionValues_sptr newValues(new API::FunctionValues(*newDomain));
+    newValues->setFitData(y);
+    newValues->setFitWeights(1.0);
+    reusing->setFittingFunction(fnWithBk, newDomain, newValues);
+    plain->setFittingFunction(fnWithBk, newDomain, std::make_shared<API::FunctionValues>(*newValues));
+    TS_ASSERT_DELTA(reusing->val(), plain->val(), 1e-10);
+  }
+
   void test_Fixing_parameter() {
     std::vector<double> x(10), y(10);
     for (size_t i = 0; i < x.size(); ++i) {
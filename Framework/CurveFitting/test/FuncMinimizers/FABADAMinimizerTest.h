@@ -11,6 +11,7 @@
 #include "MantidCurveFitting/FuncMinimizers/FABADAMinimizer.h"
 
 #include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidCurveFitting/Algorithms/Fit.h"
@@ -249,6 +250,85 @@ public:
     TS_ASSERT(param->Double(1, 1) == fun->getParameter("Lifetime"));
   }
 
+  void test_converged_chain_without_complete_chain() {
+    auto ws2 = createExpDecayWorkspace();
+    auto fun = createTiedExpDecays();
+
+    Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setProperty("Function", fun);
+    fit.setProperty("InputWorkspace", ws2);
+    fit.setProperty("WorkspaceIndex", 0);
+    fit.setProperty("MaxIterations", 100000);
+    fit.setProperty("Minimizer", "FABADA,ChainLength=10000,StepsBetweenValues="
+                                 "10,ConvergenceCriteria=0.1,ConvergedChain"
+                                 "=ConvergedChain,Parameters=Parameters");
+
+    TS_ASSERT_THROWS_NOTHING(fit.execute());
+    TS_ASSERT(fit.isExecuted());
+
+    TS_ASSERT_DELTA(fun->getParameter("f0.Height"), 8.0, 0.1);
+    TS_ASSERT_DELTA(fun->getParameter("f0.Lifetime"), 0.5, 0.01);
+    TS_ASSERT_EQUALS(fun->getParameter("f1.Height"), 2.0);
+    TS_ASSERT_EQUALS(fun->getParameter("f1.Lifetime"), fun->getParameter("f0.Lifetime"));
+
+    MatrixWorkspace_sptr convChain = fit.getProperty("ConvergedChain");
+    TS_ASSERT(convChain);
+    TS_ASSERT_EQUALS(convChain->getNumberHistograms(), fun->nParams() + 1);
+    TS_ASSERT_EQUALS(convChain->x(0).size(), 1000);
+    ITableWorkspace_sptr param = fit.getProperty("Parameters");
+    TS_ASSERT(param);
+    TS_ASSERT(param->Double(0, 1) == fun->getParameter("f0.Height"));
+    TS_ASSERT(param->Double(1, 1) == fun->getParameter("f0.Lifetime"));
+  }
+
+  void test_outputs_do_not_depend_on_keeping_complete_chain() {
+    auto ws2 = createExpDecayWorkspace();
+    const std::string minimizer = "FABADA,ChainLength=10000,StepsBetweenValues=10,ConvergenceCriteria=0.1,Seed=7,"
+                                  "ConvergedChain=ConvergedChain,Parameters=Parameters";
+
+    Fit withChains;
+    withChains.initialize();
+    withChains.setChild(true);
+    withChains.setProperty("Function", createTiedExpDecays());
+    withChains.setProperty("InputWorkspace", ws2);
+    withChains.setProperty("MaxIterations", 100000);
+    withChains.setProperty("Minimizer", minimizer + ",Chains=Chains,PDF=PDFWithChains");
+    TS_ASSERT_THROWS_NOTHING(withChains.execute());
+
+    Fit withoutChains;
+    withoutChains.initialize();
+    withoutChains.setChild(true);
+    withoutChains.setProperty("Function", createTiedExpDecays());
+    withoutChains.setProperty("InputWorkspace", ws2);
+    withoutChains.setProperty("MaxIterations", 100000);
+    withoutChains.setProperty("Minimizer", minimizer + ",PDF=PDFWithoutChains");
+    TS_ASSERT_THROWS_NOTHING(withoutChains.execute());
+
+    MatrixWorkspace_sptr convChain = withChains.getProperty("ConvergedChain");
+    MatrixWorkspace_sptr thinnedConvChain = withoutChains.getProperty("ConvergedChain");
+    assertSameWorkspaces("ConvergedChain", convChain, thinnedConvChain);
+
+    ITableWorkspace_sptr param = withChains.getProperty("Parameters");
+    ITableWorkspace_sptr thinnedParam = withoutChains.getProperty("Parameters");
+    TS_ASSERT_EQUALS(param->rowCount(), thinnedParam->rowCount());
+    for (size_t row = 0; row < std::min(param->rowCount(), thinnedParam->rowCount()); ++row) {
+      TS_ASSERT_EQUALS(param->String(row, 0), thinnedParam->String(row, 0));
+      for (size_t column = 1; column < 4; ++column) {
+        assertSameValue("Parameters", param->Double(row, column), thinnedParam->Double(row, column));
+      }
+    }
+
+    auto &ads = AnalysisDataService::Instance();
+    const auto pdf = ads.retrieveWS<WorkspaceGroup>("PDFWithChains");
+    const auto thinnedPDF = ads.retrieveWS<WorkspaceGroup>("PDFWithoutChains");
+    assertSameWorkspaces("PDF", std::dynamic_pointer_cast<MatrixWorkspace>(pdf->getItem(0)),
+                         std::dynamic_pointer_cast<MatrixWorkspace>(thinnedPDF->getItem(0)));
+    ads.remove("PDFWithChains");
+    ads.remove("PDFWithoutChains");
+  }
+
   void test_low_MaxIterations() {
     auto ws2 = createExpDecayWorkspace();
 
@@ -387,6 +467,41 @@ private:
     return ws2;
   }
 
+  // Two exponential decays sharing one lifetime, the second with a fixed height
+  IFunction_sptr createTiedExpDecays() {
+    auto fun = std::make_shared<CompositeFunction>();
+    auto first = std::make_shared<ExpDecay>();
+    first->setParameter("Height", 6.);
+    first->setParameter("Lifetime", 1.0);
+    fun->addFunction(first);
+    fun->addFunction(std::make_shared<ExpDecay>());
+    fun->tie("f1.Height", "2");
+    fun->tie("f1.Lifetime", "f0.Lifetime");
+    return fun;
+  }
+
+  // Tied parameters give empty PDF bins, so NaNs are taken to be equal
+  void assertSameValue(const std::string &what, double value, double other) {
+    TSM_ASSERT(what, value == other || (std::isnan(value) && std::isnan(other)));
+  }
+
+  void assertSameWorkspaces(const std::string &what, const MatrixWorkspace_sptr &ws,
+                            const MatrixWorkspace_sptr &other) {
+    TS_ASSERT(ws);
+    TS_ASSERT(other);
+    if (!ws || !other) {
+      return;
+    }
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), other->getNumberHistograms());
+    for (size_t i = 0; i < std::min(ws->getNumberHistograms(), other->getNumberHistograms()); ++i) {
+      TS_ASSERT_EQUALS(ws->x(i).rawData(), other->x(i).rawData());
+      TS_ASSERT_EQUALS(ws->y(i).size(), other->y(i).size());
+      for (size_t j = 0; j < std::min(ws->y(i).size(), other->y(i).size()); ++j) {
+        assertSameValue(what, ws->y(i)[j], other->y(i)[j]);
+      }
+    }
+  }
+
   MatrixWorkspace_sptr createCosineWorkspace() {
     MatrixWorkspace_sptr ws2(new WorkspaceTester);
     ws2->initialize(1, 20, 20);
@@ -8,9 +8,11 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "FunctionDerivativeTestHelpers.h"
 #include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidCurveFitting/Functions/BackToBackExponential.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 #include <cmath>
 
@@ -190,6 +192,22 @@ public:
     TS_ASSERT_EQUALS(b2bExp.getParameter("I"), 3.0);
   }
 
+  void test_derivatives_match_finite_differences() {
+    BackToBackExponential b2bExp;
+    b2bExp.initialize();
+    b2bExp.setParameter("I", 2.1);
+    b2bExp.setParameter("A", 1.6);
+    b2bExp.setParameter("B", 0.4);
+    b2bExp.setParameter("X0", 0.3);
+    b2bExp.setParameter("S", 0.7);
+
+    Mantid::API::FunctionDomain1DVector x(-4, 6, 41);
+    FunctionDerivativeTestHelpers::checkDerivativesMatchFiniteDifferences(b2bExp, x, 1e-7);
+    // the function depends on S only through |S|
+    b2bExp.setParameter("S", -0.7);
+    FunctionDerivativeTestHelpers::checkDerivativesMatchFiniteDifferences(b2bExp, x, 1e-7);
+  }
+
   void testIntensityError() {
     const double s = 4.0;
     const double I = 2.1;
@@ -363,6 +363,43 @@ public:
     }
   }
 
+  void test_cached_resolution_follows_its_parameters() {
+    Convolution conv;
+    const double pi = acos(0.) * 2;
+    auto res = std::make_shared<ConvolutionTest_Gauss>();
+    res->setParameter("c", 0.);
+    res->setParameter("h", 3.);
+    res->setParameter("s", 1.);
+    conv.addFunction(res);
+    auto fun = std::make_shared<ConvolutionTest_Gauss>();
+    conv.addFunction(fun);
+
+    const int N = 116;
+    double x[N];
+    for (int i = 0; i < N; i++) {
+      x[i] = i * 0.13;
+    }
+    const double c2 = 0.13 * N / 2;
+    fun->setParameter("c", c2);
+    fun->setParameter("h", 10.);
+    fun->setParameter("s", 1.);
+
+    FunctionDomain1DView xView(&x[0], N);
+    FunctionValues out(xView);
+    // the parameters of the resolution are fixed, yet changing them must
+    // update the convolution
+    for (const double s1 : {1., 2., 2., 1.5}) {
+      res->setParameter("s", s1);
+      conv.function(xView, out);
+      const double sp = s1 / (s1 + 1.);
+      const double hp = 30. * sqrt(pi / (s1 + 1.));
+      for (int i = 0; i < N; i++) {
+        const double xi = x[i] - c2;
+        TS_ASSERT_DELTA(out.getCalculated(i), hp * exp(-sp * xi * xi), 1e-10);
+      }
+    }
+  }
+
   void testAttributesSetUpCorrectlyForConvolution() {
     Convolution conv;
     auto func = std::make_shared<ConvolutionTest_LinearWithAttributes>();
@@ -126,6 +126,33 @@ public:
     TS_ASSERT_EQUALS(nre, -4);
   }
 
+  void test_cached_eigensystem_follows_the_field() {
+    CrystalFieldPeaks peaks;
+    peaks.setParameter("B20", 0.37737);
+    peaks.setParameter("B22", 3.9770);
+    peaks.setParameter("B40", -0.031787);
+    peaks.setAttributeValue("Ion", "Ce");
+    Mantid::CurveFitting::DoubleFortranVector en0, en1, en;
+    Mantid::CurveFitting::ComplexFortranMatrix wf;
+    int nre = 0;
+    peaks.calculateEigenSystem(en0, wf, nre);
+    peaks.setParameter("B20", 0.5);
+    peaks.calculateEigenSystem(en1, wf, nre);
+    TS_ASSERT_DIFFERS(en1(2), en0(2));
+    // back to a field in the cache
+    peaks.setParameter("B20", 0.37737);
+    peaks.calculateEigenSystem(en, wf, nre);
+    TS_ASSERT_EQUALS(en.size(), en0.size());
+    for (int i = 1; i <= static_cast<int>(en.size()); ++i) {
+      TS_ASSERT_EQUALS(en(i), en0(i));
+    }
+    // a different ion with the same field
+    peaks.setAttributeValue("Ion", "Pr");
+    peaks.calculateEigenSystem(en, wf, nre);
+    TS_ASSERT_EQUALS(nre, 2);
+    TS_ASSERT_DIFFERS(en.size(), en0.size());
+  }
+
   void test_evaluate_alg_no_input_workspace() {
     IFunction_sptr fun(new CrystalFieldPeaks);
     FunctionDomainGeneral domain;
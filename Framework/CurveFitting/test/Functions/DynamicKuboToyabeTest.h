@@ -13,6 +13,9 @@
 #include "MantidCurveFitting/Functions/DynamicKuboToyabe.h"
 #include "MantidCurveFitting/Functions/StaticKuboToyabe.h"
 
+#include <array>
+#include <thread>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::CurveFitting;
@@ -132,4 +135,39 @@ public:
     TS_ASSERT_DELTA(y[3], 0.297548, 0.000001);
     TS_ASSERT_DELTA(y[4], 0.177036, 0.000001);
   }
+
+  void testInstancesCanBeEvaluatedConcurrently() {
+    // The cached tables belong to each instance, so functions with different
+    // parameters evaluated on separate threads do not disturb each other
+    TS_ASSERT(DynamicKuboToyabe().threadSafe());
+    const std::array<double, 2> fields{0.0, 0.1};
+    const std::array<double, 2> nus{1.0, 0.5};
+    const std::array<std::array<double, 5>, 2> expected{
+        {{1.000000, 0.850107, 0.625283, 0.449064, 0.323394}, {1.000000, 0.821663, 0.518974, 0.297548, 0.177036}}};
+    std::array<DynamicKuboToyabe, 2> dkts;
+    std::array<bool, 2> allMatch{true, true};
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < dkts.size(); ++i) {
+      dkts[i].initialize();
+      dkts[i].setParameter("Delta", 0.39);
+      threads.emplace_back([&, i]() {
+        Mantid::API::FunctionDomain1DVector x(0, 5, 5);
+        Mantid::API::FunctionValues y(x);
+        for (int repeat = 0; repeat < 20; ++repeat) {
+          // alternate the field so that the tables are recomputed every time
+          dkts[i].setParameter("Field", repeat % 2 == 0 ? fields[i] : 0.2);
+          dkts[i].setParameter("Nu", nus[i]);
+          dkts[i].function(x, y);
+          if (repeat % 2 != 0)
+            continue;
+          for (size_t j = 0; j < expected[i].size(); ++j)
+            allMatch[i] = allMatch[i] && std::abs(y[j] - expected[i][j]) < 1e-6;
+        }
+      });
+    }
+    for (auto &thread : threads)
+      thread.join();
+    TS_ASSERT(allMatch[0]);
+    TS_ASSERT(allMatch[1]);
+  }
 };
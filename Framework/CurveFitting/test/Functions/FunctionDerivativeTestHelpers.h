@@ -0,0 +1,54 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
+#include "MantidAPI/IFunction.h"
+#include "MantidCurveFitting/Jacobian.h"
+
+#include <string>
+
+// Helpers to check the derivatives that fit functions calculate
+namespace FunctionDerivativeTestHelpers {
+
+/**
+ * Check that the derivatives calculated by a function agree with central
+ * finite differences of its values.
+ * @param function :: the function, with the parameters to check at
+ * @param domain :: the points to check at
+ * @param tolerance :: the largest allowed difference of each derivative
+ * @param step :: the change of each parameter in the finite differences
+ * @return the derivatives calculated by the function
+ */
+inline Mantid::CurveFitting::Jacobian checkDerivativesMatchFiniteDifferences(Mantid::API::IFunction &function,
+                                                                           const Mantid::API::FunctionDomain1D &domain,
+                                                                           const double tolerance,
+                                                                           const double step = 1e-6) {
+  const size_t nParams = function.nParams();
+  Mantid::CurveFitting::Jacobian jacobian(domain.size(), nParams);
+  function.functionDeriv(domain, jacobian);
+
+  for (size_t iP = 0; iP < nParams; ++iP) {
+    const double value = function.getParameter(iP);
+    Mantid::API::FunctionValues plus(domain), minus(domain);
+    function.setParameter(iP, value + step);
+    function.function(domain, plus);
+    function.setParameter(iP, value - step);
+    function.function(domain, minus);
+    function.setParameter(iP, value);
+    for (size_t i = 0; i < domain.size(); ++i) {
+      TSM_ASSERT_DELTA(function.parameterName(iP) + " at " + std::to_string(domain[i]), jacobian.get(i, iP),
+                       (plus[i] - minus[i]) / (2 * step), tolerance);
+    }
+  }
+  return jacobian;
+}
+
+} // namespace FunctionDerivativeTestHelpers
@@ -8,7 +8,9 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "FunctionDerivativeTestHelpers.h"
 #include "MantidCurveFitting/Functions/StretchExpMuon.h"
+#include "MantidCurveFitting/Jacobian.h"
 
 using namespace Mantid::CurveFitting::Functions;
 
@@ -45,4 +47,18 @@ public:
     TS_ASSERT_DELTA(y[8], 0.1214, 1e-4);
     TS_ASSERT_DELTA(y[9], 0.1068, 1e-4);
   }
+
+  void test_derivatives_match_finite_differences() {
+    StretchExpMuon fn;
+    fn.initialize();
+    fn.setParameter("A", 1.00);
+    fn.setParameter("Lambda", 2.5);
+    fn.setParameter("Beta", 0.50);
+
+    Mantid::API::FunctionDomain1DVector x(0, 2, 10);
+    auto jacobian = FunctionDerivativeTestHelpers::checkDerivativesMatchFiniteDifferences(fn, x, 1e-6);
+    // the derivatives at x = 0 are exactly those of A
+    for (size_t iP = 0; iP < 3; ++iP)
+      TS_ASSERT_EQUALS(jacobian.get(0, iP), iP == 0 ? 1.0 : 0.0);
+  }
 };
@@ -6,10 +6,12 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "FunctionDerivativeTestHelpers.h"
 #include "MantidAPI/FunctionDomain1D.h"
 #include "MantidAPI/FunctionValues.h"
 #include "MantidCurveFitting/Functions/TeixeiraWaterSQE.h"
 #include <cxxtest/TestSuite.h>
+#include <cmath>
 #include <numeric>
 #include <random>
 
@@ -72,6 +74,27 @@ public:
     TS_ASSERT_DELTA(integral, 1.0, 0.01);
   }
 
+  void test_derivatives_match_finite_differences() {
+    auto func = createTestTeixeiraWaterSQE();
+    Mantid::API::FunctionDomain1DVector x(-1.0, 1.0, 21);
+    FunctionDerivativeTestHelpers::checkDerivativesMatchFiniteDifferences(*func, x, 1e-6);
+  }
+
+  void test_derivatives_are_zero_where_the_function_is_penalized() {
+    auto func = createTestTeixeiraWaterSQE();
+    func->setParameter("DiffCoeff", 0.0);
+    Mantid::API::FunctionDomain1DVector x(-1.0, 1.0, 5);
+    Mantid::API::FunctionValues values(x);
+    func->function(x, values);
+    Mantid::CurveFitting::Jacobian jacobian(x.size(), func->nParams());
+    func->functionDeriv(x, jacobian);
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT(std::isinf(values[i]));
+      for (size_t iP = 0; iP < func->nParams(); ++iP)
+        TS_ASSERT_EQUALS(jacobian.get(i, iP), 0.0);
+    }
+  }
+
 private:
   class TestableTeixeiraWaterSQE : public TeixeiraWaterSQE {
   public:
@@ -9,8 +9,13 @@
 #include <cxxtest/TestSuite.h>
 
 #include "MantidAPI/FunctionDomain1D.h"
+#include "MantidAPI/FunctionValues.h"
 #include "MantidAPI/Jacobian.h"
+#include "MantidCurveFitting/Algorithms/Fit.h"
 #include "MantidCurveFitting/Functions/UserFunction.h"
+#include "MantidFrameworkTestHelpers/FakeObjects.h"
+
+#include <cmath>
 
 using namespace Mantid::CurveFitting;
 using namespace Mantid::CurveFitting::Functions;
@@ -77,6 +82,89 @@ public:
     TS_ASSERT(categories[0] == "General");
   }
 
+  void test_derivatives_of_compiled_formula_are_exact() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*exp(-b*x^2) + c/x"));
+    fun.setParameter("a", 1.5);
+    fun.setParameter("b", 0.3);
+    fun.setParameter("c", -2.0);
+
+    std::vector<double> x{0.5, 1.0, 1.5, 2.0};
+    FunctionDomain1DVector domain(x);
+    FunctionValues values(domain);
+    fun.function(domain, values);
+    UserTestJacobian J(4, 3);
+    fun.functionDeriv(domain, J);
+    for (size_t i = 0; i < x.size(); i++) {
+      const double gaussian = std::exp(-0.3 * x[i] * x[i]);
+      TS_ASSERT_DELTA(values[i], 1.5 * gaussian - 2.0 / x[i], 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 0), gaussian, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 1), -1.5 * x[i] * x[i] * gaussian, 1e-12);
+      TS_ASSERT_DELTA(J.get(i, 2), 1.0 / x[i], 1e-12);
+    }
+  }
+
+  void test_derivatives_follow_ties() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*x + b*x^2"));
+    fun.setParameter("a", 1.0);
+    fun.tie("b", "2*a");
+    fun.applyTies();
+
+    std::vector<double> x{0.5, 1.0, 1.5, 2.0};
+    FunctionDomain1DVector domain(x);
+    UserTestJacobian J(4, 2);
+    fun.functionDeriv(domain, J);
+    for (size_t i = 0; i < x.size(); i++) {
+      TS_ASSERT_DELTA(J.get(i, 0), x[i] + 2.0 * x[i] * x[i], 1e-4);
+    }
+  }
+
+  void test_fit_with_tie() {
+    auto ws = std::make_shared<WorkspaceTester>();
+    ws->initialize(1, 20, 20);
+    auto &x = ws->mutableX(0);
+    auto &y = ws->mutableY(0);
+    for (size_t i = 0; i < x.size(); i++) {
+      x[i] = 0.1 * double(i);
+      y[i] = 1.5 * x[i] + 3.0 * x[i] * x[i];
+    }
+    ws->mutableE(0) = 1.0;
+
+    Mantid::CurveFitting::Algorithms::Fit fit;
+    fit.initialize();
+    fit.setChild(true);
+    fit.setPropertyValue("Function", "name=UserFunction,Formula=a*x + b*x^2,a=1,b=2,ties=(b=2*a)");
+    fit.setProperty("InputWorkspace", std::static_pointer_cast<MatrixWorkspace>(ws));
+    TS_ASSERT_THROWS_NOTHING(fit.execute());
+    TS_ASSERT(fit.isExecuted());
+
+    IFunction_sptr fitted = fit.getProperty("Function");
+    TS_ASSERT_DELTA(fitted->getParameter("a"), 1.5, 1e-6);
+    TS_ASSERT_DELTA(fitted->getParameter("b"), 3.0, 1e-6);
+    const std::string status = fit.getProperty("OutputStatus");
+    TS_ASSERT_EQUALS(status, "success");
+  }
+
+  void test_formula_not_supported_by_compiler() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*x + b*(x > 1)"));
+    fun.setParameter("a", 2.0);
+    fun.setParameter("b", 3.0);
+
+    std::vector<double> x{0.5, 1.5};
+    FunctionDomain1DVector domain(x);
+    FunctionValues values(domain);
+    fun.function(domain, values);
+    TS_ASSERT_DELTA(values[0], 1.0, 1e-12);
+    TS_ASSERT_DELTA(values[1], 6.0, 1e-12);
+    UserTestJacobian J(2, 2);
+    fun.functionDeriv(domain, J);
+    TS_ASSERT_DELTA(J.get(1, 0), 1.5, 1e-6);
+    TS_ASSERT_DELTA(J.get(0, 1), 0.0, 1e-6);
+    TS_ASSERT_DELTA(J.get(1, 1), 1.0, 1e-6);
+  }
+
   void test_setAttribute_will_reevaluate_function_if_it_has_changed() {
     UserFunction fun;
     fun.setAttribute("Formula", UserFunction::Attribute("a*x"));
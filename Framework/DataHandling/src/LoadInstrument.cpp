@@ -12,6 +12,7 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadGeometry.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ConfigService.h"
@@ -169,13 +170,16 @@ void LoadInstrument::exec() {
 
   InstrumentDefinitionParser parser;
   std::string instrumentNameMangled;
+  std::string xmlText;
   Instrument_sptr instrument;
 
   // Define a parser if using IDFs
   if (loader_type == LoaderType::Xml)
-    parser = InstrumentDefinitionParser(filename, instname, InstrumentXML->value());
+    xmlText = InstrumentXML->value();
   else if (loader_type == LoaderType::Idf)
-    parser = InstrumentDefinitionParser(filename, instname, Strings::loadFile(filename));
+    xmlText = Strings::loadFile(filename);
+  if (loader_type < LoaderType::Nxs)
+    parser = InstrumentDefinitionParser(filename, instname, xmlText);
 
   // Find the mangled instrument name that includes the modified date
   if (loader_type < LoaderType::Nxs)
@@ -195,12 +199,23 @@ void LoadInstrument::exec() {
       instrument = InstrumentDataService::Instance().retrieve(instrumentNameMangled);
     } else {
       if (loader_type < LoaderType::Nxs) {
-        // Really create the instrument
-        Progress prog(this, 0.0, 1.0, 100);
+        // Use a copy of the instrument built by an earlier session if there is one
+        const auto cacheFile = InstrumentCache::filePath(instrumentNameMangled);
         {
+          const auto timerStart = std::chrono::high_resolution_clock::now();
+          instrument = InstrumentCache::load(cacheFile);
+          addTimer("loadInstrumentCache", timerStart, std::chrono::high_resolution_clock::now());
+        }
+        if (instrument) {
+          instrument->setFilename(filename);
+          instrument->setXmlText(xmlText);
+        } else {
+          // Really create the instrument
+          Progress prog(this, 0.0, 1.0, 100);
           const auto timerStart = std::chrono::high_resolution_clock::now();
           instrument = parser.parseXML(&prog);
           addTimer("parseXML", timerStart, std::chrono::high_resolution_clock::now());
+          InstrumentCache::save(*instrument, cacheFile);
         }
         {
           // Parse the instrument tree (internally create ComponentInfo and
@@ -103,7 +103,7 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
-    this->events->emplace_back(event);
+    this->events.access().emplace_back(event);
     if (this->order != UNSORTED)
       this->setSortOrder(UNSORTED);
   }
@@ -114,7 +114,7 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
-    this->weightedEvents->emplace_back(event);
+    this->weightedEvents.access().emplace_back(event);
     if (this->order != UNSORTED)
       this->setSortOrder(UNSORTED);
   }
@@ -125,7 +125,7 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
-    this->weightedEventsNoTime->emplace_back(event);
+    this->weightedEventsNoTime.access().emplace_back(event);
     if (this->order != UNSORTED)
       this->setSortOrder(UNSORTED);
   }
@@ -329,14 +329,15 @@ private:
   /// Histogram object holding the histogram data. Currently only X.
   HistogramData::Histogram m_histogram;
 
-  /// List of TofEvent (no weights).
-  mutable std::unique_ptr<std::vector<Types::Event::TofEvent>> events;
+  /// List of TofEvent (no weights). The event vectors are shared between
+  /// copies of an EventList until one of them is modified.
+  mutable Kernel::cow_ptr<std::vector<Types::Event::TofEvent>> events{nullptr};
 
   /// List of WeightedEvent's
-  mutable std::unique_ptr<std::vector<WeightedEvent>> weightedEvents;
+  mutable Kernel::cow_ptr<std::vector<WeightedEvent>> weightedEvents{nullptr};
 
   /// List of WeightedEvent's
-  mutable std::unique_ptr<std::vector<WeightedEventNoTime>> weightedEventsNoTime;
+  mutable Kernel::cow_ptr<std::vector<WeightedEventNoTime>> weightedEventsNoTime{nullptr};
 
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
@@ -409,8 +410,8 @@ private:
   static void histogramForWeightsHelper(const std::vector<T> &events, const double step, const MantidVec &X,
                                         MantidVec &Y, MantidVec &E);
   template <class T>
-  static void integrateHelper(std::vector<T> &events, const double minX, const double maxX, const bool entireRange,
-                              double &sum, double &error);
+  static void integrateHelper(const std::vector<T> &events, const double minX, const double maxX,
+                              const bool entireRange, double &sum, double &error);
   template <class T> void convertTofHelper(std::vector<T> &events, const std::function<double(double)> &func);
 
   template <class T> void convertTofHelper(std::vector<T> &events, const double factor, const double offset);
@@ -429,11 +430,11 @@ private:
 
   template <class T> static void setTofsHelper(std::vector<T> &events, const std::vector<double> &tofs);
   template <class T>
-  static void filterByPulseTimeHelper(std::vector<T> &events, Types::Core::DateAndTime start,
+  static void filterByPulseTimeHelper(const std::vector<T> &events, Types::Core::DateAndTime start,
                                       Types::Core::DateAndTime stop, std::vector<T> &output);
 
   template <class T>
-  static void filterByTimeROIHelper(std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
+  static void filterByTimeROIHelper(const std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
                                     EventList *output);
 
   template <class T> void filterInPlaceHelper(Kernel::TimeROI const *timeRoi, typename std::vector<T> &events);
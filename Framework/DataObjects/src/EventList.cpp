@@ -167,20 +167,20 @@ EventList::EventList(const EventType event_type)
       eventType(event_type), order(UNSORTED), mru(nullptr) {
   switch (eventType) {
   case TOF:
-    this->events = std::make_unique<std::vector<Mantid::Types::Event::TofEvent>>();
+    this->events = std::make_shared<std::vector<Mantid::Types::Event::TofEvent>>();
     this->weightedEvents = nullptr;
     this->weightedEventsNoTime = nullptr;
     break;
 
   case WEIGHTED:
     this->events = nullptr;
-    this->weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
+    this->weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
     this->weightedEventsNoTime = nullptr;
     break;
 
   case WEIGHTED_NOTIME:
     this->events = nullptr;
-    this->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+    this->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
     this->weightedEventsNoTime = nullptr;
     break;
   }
@@ -194,7 +194,7 @@ EventList::EventList(EventWorkspaceMRU *mru, specnum_t specNo)
     : IEventList(specNo),
       m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
       weightedEvents(nullptr), weightedEventsNoTime(nullptr), eventType(TOF), order(UNSORTED), mru(mru) {
-  this->events = std::make_unique<std::vector<Mantid::Types::Event::TofEvent>>();
+  this->events = std::make_shared<std::vector<Mantid::Types::Event::TofEvent>>();
 }
 
 /** Constructor copying from an existing event list
@@ -210,7 +210,7 @@ EventList::EventList(const EventList &rhs) : IEventList(rhs), m_histogram(rhs.m_
 EventList::EventList(const std::vector<Types::Event::TofEvent> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
       weightedEvents(nullptr), weightedEventsNoTime(nullptr), eventType(TOF), mru(nullptr) {
-  this->events = std::make_unique<std::vector<Mantid::Types::Event::TofEvent>>(events.cbegin(), events.cend());
+  this->events = std::make_shared<std::vector<Mantid::Types::Event::TofEvent>>(events.cbegin(), events.cend());
   this->eventType = TOF;
   this->order = UNSORTED;
 }
@@ -220,7 +220,7 @@ EventList::EventList(const std::vector<Types::Event::TofEvent> &events)
 EventList::EventList(const std::vector<WeightedEvent> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts), events(nullptr),
       weightedEventsNoTime(nullptr), mru(nullptr) {
-  this->weightedEvents = std::make_unique<std::vector<WeightedEvent>>(events.cbegin(), events.cend());
+  this->weightedEvents = std::make_shared<std::vector<WeightedEvent>>(events.cbegin(), events.cend());
   this->eventType = WEIGHTED;
   this->order = UNSORTED;
 }
@@ -230,7 +230,7 @@ EventList::EventList(const std::vector<WeightedEvent> &events)
 EventList::EventList(const std::vector<WeightedEventNoTime> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts), events(nullptr),
       weightedEvents(nullptr), mru(nullptr) {
-  this->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>(events.cbegin(), events.cend());
+  this->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>(events.cbegin(), events.cend());
   this->eventType = WEIGHTED_NOTIME;
   this->order = UNSORTED;
 }
@@ -247,9 +247,9 @@ EventList::~EventList() {
   }
 
   // set all member vectors to nullptr
-  this->events.reset();
-  this->weightedEvents.reset();
-  this->weightedEventsNoTime.reset();
+  this->events = nullptr;
+  this->weightedEvents = nullptr;
+  this->weightedEventsNoTime = nullptr;
 }
 
 /// Copy data from another EventList, via ISpectrum reference.
@@ -258,20 +258,19 @@ void EventList::copyDataFrom(const ISpectrum &source) { source.copyDataInto(*thi
 /// Used by copyDataFrom for dynamic dispatch for its `source`.
 void EventList::copyDataInto(EventList &sink) const {
   sink.m_histogram = m_histogram;
+  // The events are shared until either list is modified
   if (events)
-    sink.events = std::make_unique<std::vector<Types::Event::TofEvent>>(events->cbegin(), events->cend());
+    sink.events = events;
   else if (sink.events)
-    sink.events = std::make_unique<std::vector<Types::Event::TofEvent>>();
+    sink.events = std::make_shared<std::vector<Types::Event::TofEvent>>();
   if (weightedEvents)
-    sink.weightedEvents =
-        std::make_unique<std::vector<WeightedEvent>>(weightedEvents->cbegin(), weightedEvents->cend());
+    sink.weightedEvents = weightedEvents;
   else if (sink.weightedEvents)
-    sink.weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
+    sink.weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
   if (weightedEventsNoTime)
-    sink.weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>(weightedEventsNoTime->cbegin(),
-                                                                                   weightedEventsNoTime->cend());
+    sink.weightedEventsNoTime = weightedEventsNoTime;
   else if (sink.weightedEventsNoTime)
-    sink.weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+    sink.weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
 
   sink.eventType = eventType;
   sink.order = order;
@@ -309,7 +308,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
   // We need weights but have no way to set the time. So use weighted, no time
   this->switchTo(WEIGHTED_NOTIME);
   if (GenerateZeros)
-    this->weightedEventsNoTime->reserve(Y.size());
+    this->weightedEventsNoTime.access().reserve(Y.size());
 
   for (size_t i = 0; i < X.size() - 1; i++) {
     double weight = Y[i];
@@ -340,7 +339,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
             double tof = X[i] + tofStep * (0.5 + double(j));
             // Create and add the event
             // TODO: try emplace_back() here.
-            weightedEventsNoTime->emplace_back(tof, weight, errorSquared);
+            weightedEventsNoTime.access().emplace_back(tof, weight, errorSquared);
           }
         } else {
           // --------- Single event per bin ----------
@@ -350,7 +349,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
           double errorSquared = E[i];
           errorSquared *= errorSquared;
           // Create and add the event
-          weightedEventsNoTime->emplace_back(tof, weight, errorSquared);
+          weightedEventsNoTime.access().emplace_back(tof, weight, errorSquared);
         }
       } // error is nont NAN or infinite
     } // weight is non-zero, not NAN, and non-infinite
@@ -391,15 +390,15 @@ EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
   switch (this->eventType) {
   case TOF:
     // Simply push the events
-    this->events->emplace_back(event);
+    this->events.access().emplace_back(event);
     break;
 
   case WEIGHTED:
-    this->weightedEvents->emplace_back(event);
+    this->weightedEvents.access().emplace_back(event);
     break;
 
   case WEIGHTED_NOTIME:
-    this->weightedEventsNoTime->emplace_back(event);
+    this->weightedEventsNoTime.access().emplace_back(event);
     break;
   }
 
@@ -416,25 +415,31 @@ EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
  * */
 EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more_events) {
   switch (this->eventType) {
-  case TOF:
+  case TOF: {
     // Simply push the events
-    this->events->insert(this->events->end(), more_events.cbegin(), more_events.cend());
+    auto &target = this->events.access();
+    target.insert(target.end(), more_events.cbegin(), more_events.cend());
     break;
+  }
 
-  case WEIGHTED:
+  case WEIGHTED: {
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEvents->reserve(this->weightedEvents->size() + more_events.size());
-    std::copy(more_events.cbegin(), more_events.cend(), std::back_inserter(*this->weightedEvents));
+    auto &target = this->weightedEvents.access();
+    target.reserve(target.size() + more_events.size());
+    std::copy(more_events.cbegin(), more_events.cend(), std::back_inserter(target));
     break;
+  }
 
-  case WEIGHTED_NOTIME:
+  case WEIGHTED_NOTIME: {
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEventsNoTime->reserve(this->weightedEventsNoTime->size() + more_events.size());
-    std::copy(more_events.cbegin(), more_events.cend(), std::back_inserter(*this->weightedEventsNoTime));
+    auto &target = this->weightedEventsNoTime.access();
+    target.reserve(target.size() + more_events.size());
+    std::copy(more_events.cbegin(), more_events.cend(), std::back_inserter(target));
     break;
   }
+  }
 
   this->order = UNSORTED;
   return *this;
@@ -450,7 +455,7 @@ EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
   this->switchTo(WEIGHTED);
-  this->weightedEvents->emplace_back(event);
+  this->weightedEvents.access().emplace_back(event);
   this->order = UNSORTED;
   return *this;
 }
@@ -470,18 +475,22 @@ EventList &EventList::operator+=(const std::vector<WeightedEvent> &more_events)
     this->switchTo(WEIGHTED);
     // Fall through to the insertion!
 
-  case WEIGHTED:
+  case WEIGHTED: {
     // Append the two lists
-    this->weightedEvents->insert(weightedEvents->end(), more_events.cbegin(), more_events.cend());
+    auto &target = this->weightedEvents.access();
+    target.insert(target.end(), more_events.cbegin(), more_events.cend());
     break;
+  }
 
-  case WEIGHTED_NOTIME:
+  case WEIGHTED_NOTIME: {
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEventsNoTime->reserve(this->weightedEventsNoTime->size() + more_events.size());
-    std::copy(more_events.cbegin(), more_events.cend(), std::back_inserter(*this->weightedEventsNoTime));
+    auto &target = this->weightedEventsNoTime.access();
+    target.reserve(target.size() + more_events.size());
+    std::copy(more_events.cbegin(), more_events.cend(), std::back_inserter(target));
     break;
   }
+  }
 
   this->order = UNSORTED;
   return *this;
@@ -503,11 +512,13 @@ EventList &EventList::operator+=(const std::vector<WeightedEventNoTime> &more_ev
     this->switchTo(WEIGHTED_NOTIME);
     // Fall through to the insertion!
 
-  case WEIGHTED_NOTIME:
+  case WEIGHTED_NOTIME: {
     // Simple appending of the two lists
-    this->weightedEventsNoTime->insert(weightedEventsNoTime->end(), more_events.cbegin(), more_events.cend());
+    auto &target = this->weightedEventsNoTime.access();
+    target.insert(target.end(), more_events.cbegin(), more_events.cend());
     break;
   }
+  }
 
   this->order = UNSORTED;
   return *this;
@@ -601,14 +612,14 @@ EventList &EventList::operator-=(const EventList &more_events) {
   case WEIGHTED:
     switch (more_events.getEventType()) {
     case TOF:
-      minusHelper(*this->weightedEvents, *more_events.events);
+      minusHelper(this->weightedEvents.access(), *more_events.events);
       break;
     case WEIGHTED:
-      minusHelper(*this->weightedEvents, *more_events.weightedEvents);
+      minusHelper(this->weightedEvents.access(), *more_events.weightedEvents);
       break;
     case WEIGHTED_NOTIME:
       // TODO: Should this throw?
-      minusHelper(*this->weightedEvents, *more_events.weightedEventsNoTime);
+      minusHelper(this->weightedEvents.access(), *more_events.weightedEventsNoTime);
       break;
     }
     break;
@@ -616,13 +627,13 @@ EventList &EventList::operator-=(const EventList &more_events) {
   case WEIGHTED_NOTIME:
     switch (more_events.getEventType()) {
     case TOF:
-      minusHelper(*this->weightedEventsNoTime, *more_events.events);
+      minusHelper(this->weightedEventsNoTime.access(), *more_events.events);
       break;
     case WEIGHTED:
-      minusHelper(*this->weightedEventsNoTime, *more_events.weightedEvents);
+      minusHelper(this->weightedEventsNoTime.access(), *more_events.weightedEvents);
       break;
     case WEIGHTED_NOTIME:
-      minusHelper(*this->weightedEventsNoTime, *more_events.weightedEventsNoTime);
+      minusHelper(this->weightedEventsNoTime.access(), *more_events.weightedEventsNoTime);
       break;
     }
     break;
@@ -640,10 +651,10 @@ namespace {
  * Both can be nullptr, or the values can be equal, but do not have one nullptr
  */
 template <typename T>
-bool vectorPtrEquals(const std::unique_ptr<std::vector<T>> &left, const std::unique_ptr<std::vector<T>> &right) {
+bool vectorPtrEquals(const Kernel::cow_ptr<std::vector<T>> &left, const Kernel::cow_ptr<std::vector<T>> &right) {
   if (left && right) {
-    return (*left == *right);
-    ;
+    // shared events are trivially equal
+    return left == right || (*left == *right);
   } else if ((left && !right) || (right && !left)) {
     return false;
   }
@@ -785,11 +796,11 @@ void EventList::switchToWeightedEvents() {
   case TOF:
     if (events && !events->empty()) {
       // Convert and copy all TofEvents to the weightedEvents list.
-      weightedEvents = std::make_unique<std::vector<WeightedEvent>>(events->cbegin(), events->cend());
+      weightedEvents = std::make_shared<std::vector<WeightedEvent>>(events->cbegin(), events->cend());
       // Get rid of the old events
-      events.reset();
+      events = nullptr;
     } else {
-      weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
+      weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
     }
     eventType = WEIGHTED;
     break;
@@ -809,11 +820,11 @@ void EventList::switchToWeightedEventsNoTime() {
   case TOF: {
     if (events && !events->empty()) {
       // Convert and copy all TofEvents to the weightedEvents list.
-      this->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>(events->cbegin(), events->cend());
+      this->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>(events->cbegin(), events->cend());
       // Get rid of the old events
-      events.reset();
+      events = nullptr;
     } else {
-      this->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+      this->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
     }
     break;
   }
@@ -822,11 +833,11 @@ void EventList::switchToWeightedEventsNoTime() {
     // Convert and copy all TofEvents to the weightedEvents list.
     if (weightedEvents && !weightedEvents->empty()) {
       this->weightedEventsNoTime =
-          std::make_unique<std::vector<WeightedEventNoTime>>(weightedEvents->cbegin(), weightedEvents->cend());
+          std::make_shared<std::vector<WeightedEventNoTime>>(weightedEvents->cbegin(), weightedEvents->cend());
       // Get rid of the old events
-      weightedEvents.reset();
+      weightedEvents = nullptr;
     } else {
-      this->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+      this->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
     }
     break;
   }
@@ -892,7 +903,7 @@ std::vector<TofEvent> &EventList::getEvents() {
     throw std::runtime_error("EventList::getEvents() called for an EventList that has weights. Use getWeightedEvents() "
                              "or getWeightedEventsNoTime().");
   if (this->events)
-    return *this->events;
+    return this->events.access();
   else
     throw std::runtime_error("unweighted event vector is not initialized");
 }
@@ -909,7 +920,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
     throw std::runtime_error("EventList::getWeightedEvents() called for an EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
   if (this->weightedEvents)
-    return *this->weightedEvents;
+    return this->weightedEvents.access();
   else
     throw std::runtime_error("weighted event vector is not initialized");
 }
@@ -941,7 +952,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for an EventList not of type "
                              "WeightedEventNoTime. Use getEvents() or getWeightedEvents().");
   if (this->weightedEventsNoTime)
-    return *this->weightedEventsNoTime;
+    return this->weightedEventsNoTime.access();
   else
     throw std::runtime_error("weighted event no time vector is not initialed");
 }
@@ -977,18 +988,17 @@ void EventList::clear(const bool removeDetIDs) {
 
   // release unused memory or allocate new vector
   // rather than creating a new object, reset existing pointer
+  // A new vector releases the memory, or leaves the events to any other
+  // EventList still sharing them, without having to copy them first.
   if (!this->empty()) {
     if (this->events && eventType == TOF) {
-      this->events->clear();
-      std::vector<TofEvent>().swap(*this->events); // STL Trick to release memory
+      this->events = std::make_shared<std::vector<TofEvent>>();
     }
     if (this->weightedEvents && eventType == WEIGHTED) {
-      this->weightedEvents->clear();
-      std::vector<WeightedEvent>().swap(*this->weightedEvents); // STL Trick to release memory
+      this->weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
     }
     if (this->weightedEventsNoTime && eventType == WEIGHTED_NOTIME) {
-      this->weightedEventsNoTime->clear();
-      std::vector<WeightedEventNoTime>().swap(*this->weightedEventsNoTime); // STL Trick to release memory
+      this->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
     }
   }
   if (removeDetIDs)
@@ -1001,13 +1011,13 @@ void EventList::clear(const bool removeDetIDs) {
  * */
 void EventList::clearUnused() {
   if (eventType != TOF && (this->events)) {
-    this->events.reset();
+    this->events = nullptr;
   }
   if (eventType != WEIGHTED && (this->weightedEvents)) {
-    this->weightedEvents.reset();
+    this->weightedEvents = nullptr;
   }
   if (eventType != WEIGHTED_NOTIME && (this->weightedEventsNoTime)) {
-    this->weightedEventsNoTime.reset();
+    this->weightedEventsNoTime = nullptr;
   }
 }
 
@@ -1030,13 +1040,13 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
 void EventList::reserve(size_t num) {
   switch (this->eventType) {
   case TOF:
-    this->events->reserve(num);
+    this->events.access().reserve(num);
     break;
   case WEIGHTED:
-    this->weightedEvents->reserve(num);
+    this->weightedEvents.access().reserve(num);
     break;
   case WEIGHTED_NOTIME:
-    this->weightedEventsNoTime->reserve(num);
+    this->weightedEventsNoTime.access().reserve(num);
     break;
   }
 }
@@ -1098,6 +1108,12 @@ template <class RandomIt, class Compare> void switchable_sort(RandomIt first, Ra
   else
     tbb::parallel_sort(first, last, comp);
 }
+
+/// Sort the events held by a cow_ptr, detaching them from any copies of the list first
+template <class T, class... Compare> void switchable_sort(Kernel::cow_ptr<std::vector<T>> &events, Compare... comp) {
+  auto &vec = events.access();
+  switchable_sort(vec.begin(), vec.end(), std::move(comp)...);
+}
 } // anonymous namespace
 
 // --------------------------------------------------------------------------
@@ -1115,13 +1131,13 @@ void EventList::sortTof() const {
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end());
+    switchable_sort(events);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end());
+    switchable_sort(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
-    switchable_sort(weightedEventsNoTime->begin(), weightedEventsNoTime->end());
+    switchable_sort(weightedEventsNoTime);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1152,15 +1168,15 @@ void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift
   switch (eventType) {
   case TOF: {
     CompareTimeAtSample<TofEvent> comparitor(tofFactor, tofShift);
-    switchable_sort(events->begin(), events->end(), comparitor);
+    switchable_sort(events, comparitor);
   } break;
   case WEIGHTED: {
     CompareTimeAtSample<WeightedEvent> comparitor(tofFactor, tofShift);
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), comparitor);
+    switchable_sort(weightedEvents, comparitor);
   } break;
   case WEIGHTED_NOTIME: {
     CompareTimeAtSample<WeightedEventNoTime> comparitor(tofFactor, tofShift);
-    switchable_sort(weightedEventsNoTime->begin(), weightedEventsNoTime->end(), comparitor);
+    switchable_sort(weightedEventsNoTime, comparitor);
   } break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1182,10 +1198,10 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), compareEventPulseTime);
+    switchable_sort(events, compareEventPulseTime);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), compareEventPulseTime);
+    switchable_sort(weightedEvents, compareEventPulseTime);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1211,10 +1227,10 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), compareEventPulseTimeTOF);
+    switchable_sort(events, compareEventPulseTimeTOF);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), compareEventPulseTimeTOF);
+    switchable_sort(weightedEvents, compareEventPulseTimeTOF);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1240,10 +1256,10 @@ void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start, con
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events->begin(), events->end(), std::move(comparator));
+    switchable_sort(events, std::move(comparator));
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents->begin(), weightedEvents->end(), std::move(comparator));
+    switchable_sort(weightedEvents, std::move(comparator));
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1275,16 +1291,22 @@ void EventList::reverse() {
   // flip the events if they are tof sorted
   if (this->isSortedByTof()) {
     switch (eventType) {
-    case TOF:
-      std::reverse(this->events->begin(), this->events->end());
+    case TOF: {
+      auto &vec = this->events.access();
+      std::reverse(vec.begin(), vec.end());
       break;
-    case WEIGHTED:
-      std::reverse(this->weightedEvents->begin(), this->weightedEvents->end());
+    }
+    case WEIGHTED: {
+      auto &vec = this->weightedEvents.access();
+      std::reverse(vec.begin(), vec.end());
       break;
-    case WEIGHTED_NOTIME:
-      std::reverse(this->weightedEventsNoTime->begin(), this->weightedEventsNoTime->end());
+    }
+    case WEIGHTED_NOTIME: {
+      auto &vec = this->weightedEventsNoTime.access();
+      std::reverse(vec.begin(), vec.end());
       break;
     }
+    }
     // And we are still sorted! :)
   }
   // Otherwise, do nothing. If it was sorted by pulse time, then it still is
@@ -1831,7 +1853,7 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED_NOTIME)
-      destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+      destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
   } else {
     this->sortTof();
     switch (eventType) {
@@ -1840,8 +1862,8 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
       //        compressEventsParallelHelper(this->events,
       //        destination->weightedEventsNoTime, tolerance);
       //      else
-      destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
-      compressEventsHelper(*this->events, *destination->weightedEventsNoTime, tolerance);
+      destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
+      compressEventsHelper(*this->events, destination->weightedEventsNoTime.access(), tolerance);
       break;
 
     case WEIGHTED:
@@ -1849,15 +1871,15 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
       //        compressEventsParallelHelper(this->weightedEvents,
       //        destination->weightedEventsNoTime, tolerance);
       //      else
-      destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
-      compressEventsHelper(*this->weightedEvents, *destination->weightedEventsNoTime, tolerance);
+      destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
+      compressEventsHelper(*this->weightedEvents, destination->weightedEventsNoTime.access(), tolerance);
 
       break;
 
     case WEIGHTED_NOTIME:
       if (destination == this) {
         // Put results in a temp output
-        auto out = std::make_unique<std::vector<WeightedEventNoTime>>();
+        auto out = std::make_shared<std::vector<WeightedEventNoTime>>();
         //        if (parallel)
         //          compressEventsParallelHelper(this->weightedEventsNoTime,
         //          out,
@@ -1865,14 +1887,14 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
         //        else
         compressEventsHelper(*this->weightedEventsNoTime, *out, tolerance);
         // Put it back
-        this->weightedEventsNoTime.swap(out);
+        this->weightedEventsNoTime = std::move(out);
       } else {
         //        if (parallel)
         //          compressEventsParallelHelper(this->weightedEventsNoTime,
         //          destination->weightedEventsNoTime, tolerance);
         //        else
-        destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
-        compressEventsHelper(*this->weightedEventsNoTime, *destination->weightedEventsNoTime, tolerance);
+        destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
+        compressEventsHelper(*this->weightedEventsNoTime, destination->weightedEventsNoTime.access(), tolerance);
       }
       break;
     }
@@ -1928,7 +1950,7 @@ void EventList::compressEvents(double tolerance, EventList *destination,
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED_NOTIME)
-      destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
+      destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
   } else {
     const auto NUM_BINS = histogram_bin_edges->size() - 1;
     const auto xmin = static_cast<double>(histogram_bin_edges->front());
@@ -1951,27 +1973,28 @@ void EventList::compressEvents(double tolerance, EventList *destination,
       // average TOFs
       std::transform(tof.begin(), tof.end(), count.begin(), tof.begin(), std::divides<double>());
 
-      destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
-      createWeightedEvents(*destination->weightedEventsNoTime, tof, count, count);
+      destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
+      createWeightedEvents(destination->weightedEventsNoTime.access(), tof, count, count);
       break;
     }
 
     case WEIGHTED: {
-      destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
-      processWeightedEvents(*this->weightedEvents, *destination->weightedEventsNoTime, histogram_bin_edges, findBin);
+      destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
+      processWeightedEvents(*this->weightedEvents, destination->weightedEventsNoTime.access(), histogram_bin_edges,
+                            findBin);
       break;
     }
     case WEIGHTED_NOTIME:
       if (destination == this) {
         // Put results in a temp output
-        auto out = std::make_unique<std::vector<WeightedEventNoTime>>();
+        auto out = std::make_shared<std::vector<WeightedEventNoTime>>();
         processWeightedEvents(*this->weightedEventsNoTime, *out, histogram_bin_edges, findBin);
         // Put it back
-        this->weightedEventsNoTime.swap(out);
+        this->weightedEventsNoTime = std::move(out);
       } else {
-        destination->weightedEventsNoTime = std::make_unique<std::vector<WeightedEventNoTime>>();
-        processWeightedEvents(*this->weightedEventsNoTime, *destination->weightedEventsNoTime, histogram_bin_edges,
-                              findBin);
+        destination->weightedEventsNoTime = std::make_shared<std::vector<WeightedEventNoTime>>();
+        processWeightedEvents(*this->weightedEventsNoTime, destination->weightedEventsNoTime.access(),
+                              histogram_bin_edges, findBin);
       }
       break;
     }
@@ -1990,27 +2013,28 @@ void EventList::compressFatEvents(const double tolerance, const Mantid::Types::C
   if (this->empty()) {
     // allocate memory in correct vector
     if (eventType != WEIGHTED)
-      destination->weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
+      destination->weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
   } else {
     switch (eventType) {
     case WEIGHTED_NOTIME:
       throw std::invalid_argument("Cannot compress events that do not have pulsetime");
     case TOF:
       this->sortPulseTimeTOFDelta(timeStart, seconds);
-      destination->weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
-      compressFatEventsHelper(*this->events, *destination->weightedEvents, tolerance, timeStart, seconds);
+      destination->weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
+      compressFatEventsHelper(*this->events, destination->weightedEvents.access(), tolerance, timeStart, seconds);
       break;
     case WEIGHTED:
       this->sortPulseTimeTOFDelta(timeStart, seconds);
       if (destination == this) {
         // Put results in a temp output
-        auto out = std::make_unique<std::vector<WeightedEvent>>();
+        auto out = std::make_shared<std::vector<WeightedEvent>>();
         compressFatEventsHelper(*this->weightedEvents, *out, tolerance, timeStart, seconds);
         // Put it back
-        this->weightedEvents.swap(out);
+        this->weightedEvents = std::move(out);
       } else {
-        destination->weightedEvents = std::make_unique<std::vector<WeightedEvent>>();
-        compressFatEventsHelper(*this->weightedEvents, *destination->weightedEvents, tolerance, timeStart, seconds);
+        destination->weightedEvents = std::make_shared<std::vector<WeightedEvent>>();
+        compressFatEventsHelper(*this->weightedEvents, destination->weightedEvents.access(), tolerance, timeStart,
+                                seconds);
       }
       break;
     }
@@ -2758,8 +2782,8 @@ void EventList::generateErrorsHistogram(const MantidVec &Y, MantidVec &E) const
  * @param error :: reference to a double to put the error in.
  */
 template <class T>
-void EventList::integrateHelper(std::vector<T> &events, const double minX, const double maxX, const bool entireRange,
-                                double &sum, double &error) {
+void EventList::integrateHelper(const std::vector<T> &events, const double minX, const double maxX,
+                                const bool entireRange, double &sum, double &error) {
   sum = 0;
   error = 0;
   // Nothing in the list?
@@ -2871,13 +2895,13 @@ void EventList::convertTof(std::function<double(double)> func, const int sorting
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->convertTofHelper(*this->events, func);
+    this->convertTofHelper(this->events.access(), func);
     break;
   case WEIGHTED:
-    this->convertTofHelper(*this->weightedEvents, func);
+    this->convertTofHelper(this->weightedEvents.access(), func);
     break;
   case WEIGHTED_NOTIME:
-    this->convertTofHelper(*this->weightedEventsNoTime, func);
+    this->convertTofHelper(this->weightedEventsNoTime.access(), func);
     break;
   }
 }
@@ -2913,13 +2937,13 @@ void EventList::convertTof(const double factor, const double offset) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->convertTofHelper(*this->events, factor, offset);
+    this->convertTofHelper(this->events.access(), factor, offset);
     break;
   case WEIGHTED:
-    this->convertTofHelper(*this->weightedEvents, factor, offset);
+    this->convertTofHelper(this->weightedEvents.access(), factor, offset);
     break;
   case WEIGHTED_NOTIME:
-    this->convertTofHelper(*this->weightedEventsNoTime, factor, offset);
+    this->convertTofHelper(this->weightedEventsNoTime.access(), factor, offset);
     break;
   }
 }
@@ -2995,10 +3019,10 @@ void EventList::addPulsetime(const double seconds) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->addPulsetimeHelper(*this->events, seconds);
+    this->addPulsetimeHelper(this->events.access(), seconds);
     break;
   case WEIGHTED:
-    this->addPulsetimeHelper(*this->weightedEvents, seconds);
+    this->addPulsetimeHelper(this->weightedEvents.access(), seconds);
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::addPulsetime() called on an event "
@@ -3023,10 +3047,10 @@ void EventList::addPulsetimes(const std::vector<double> &seconds) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->addPulsetimesHelper(*this->events, seconds);
+    this->addPulsetimesHelper(this->events.access(), seconds);
     break;
   case WEIGHTED:
-    this->addPulsetimesHelper(*this->weightedEvents, seconds);
+    this->addPulsetimesHelper(this->weightedEvents.access(), seconds);
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::addPulsetime() called on an event "
@@ -3098,15 +3122,15 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
   switch (eventType) {
   case TOF:
     numOrig = this->events->size();
-    numDel = this->maskTofHelper(*this->events, tofMin, tofMax);
+    numDel = this->maskTofHelper(this->events.access(), tofMin, tofMax);
     break;
   case WEIGHTED:
     numOrig = this->weightedEvents->size();
-    numDel = this->maskTofHelper(*this->weightedEvents, tofMin, tofMax);
+    numDel = this->maskTofHelper(this->weightedEvents.access(), tofMin, tofMax);
     break;
   case WEIGHTED_NOTIME:
     numOrig = this->weightedEventsNoTime->size();
-    numDel = this->maskTofHelper(*this->weightedEventsNoTime, tofMin, tofMax);
+    numDel = this->maskTofHelper(this->weightedEventsNoTime.access(), tofMin, tofMax);
     break;
   }
 
@@ -3165,15 +3189,15 @@ void EventList::maskCondition(const std::vector<bool> &mask) {
   switch (eventType) {
   case TOF:
     numOrig = this->events->size();
-    numDel = this->maskConditionHelper(*this->events, mask);
+    numDel = this->maskConditionHelper(this->events.access(), mask);
     break;
   case WEIGHTED:
     numOrig = this->weightedEvents->size();
-    numDel = this->maskConditionHelper(*this->weightedEvents, mask);
+    numDel = this->maskConditionHelper(this->weightedEvents.access(), mask);
     break;
   case WEIGHTED_NOTIME:
     numOrig = this->weightedEventsNoTime->size();
-    numDel = this->maskConditionHelper(*this->weightedEventsNoTime, mask);
+    numDel = this->maskConditionHelper(this->weightedEventsNoTime.access(), mask);
     break;
   }
 
@@ -3710,13 +3734,13 @@ void EventList::setTofs(const MantidVec &tofs) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->setTofsHelper(*this->events, tofs);
+    this->setTofsHelper(this->events.access(), tofs);
     break;
   case WEIGHTED:
-    this->setTofsHelper(*this->weightedEvents, tofs);
+    this->setTofsHelper(this->weightedEvents.access(), tofs);
     break;
   case WEIGHTED_NOTIME:
-    this->setTofsHelper(*this->weightedEventsNoTime, tofs);
+    this->setTofsHelper(this->weightedEventsNoTime.access(), tofs);
     break;
   }
 }
@@ -3814,11 +3838,11 @@ void EventList::multiply(const double value, const double error) {
     // Fall through
 
   case WEIGHTED:
-    multiplyHelper(*this->weightedEvents, value, error);
+    multiplyHelper(this->weightedEvents.access(), value, error);
     break;
 
   case WEIGHTED_NOTIME:
-    multiplyHelper(*this->weightedEventsNoTime, value, error);
+    multiplyHelper(this->weightedEventsNoTime.access(), value, error);
     break;
   }
 }
@@ -3937,13 +3961,13 @@ void EventList::multiply(const MantidVec &X, const MantidVec &Y, const MantidVec
   case WEIGHTED:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    multiplyHistogramHelper(*this->weightedEvents, X, Y, E);
+    multiplyHistogramHelper(this->weightedEvents.access(), X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    multiplyHistogramHelper(*this->weightedEventsNoTime, X, Y, E);
+    multiplyHistogramHelper(this->weightedEventsNoTime.access(), X, Y, E);
     break;
   }
 }
@@ -4074,13 +4098,13 @@ void EventList::divide(const MantidVec &X, const MantidVec &Y, const MantidVec &
   case WEIGHTED:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    divideHistogramHelper(*this->weightedEvents, X, Y, E);
+    divideHistogramHelper(this->weightedEvents.access(), X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    divideHistogramHelper(*this->weightedEventsNoTime, X, Y, E);
+    divideHistogramHelper(this->weightedEventsNoTime.access(), X, Y, E);
     break;
   }
 }
@@ -4158,10 +4182,10 @@ void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::D
   // Iterate through all events (sorted by pulse time)
   switch (eventType) {
   case TOF:
-    filterByPulseTimeHelper(*this->events, start, stop, *output.events);
+    filterByPulseTimeHelper(*this->events, start, stop, output.events.access());
     break;
   case WEIGHTED:
-    filterByPulseTimeHelper(*this->weightedEvents, start, stop, *output.weightedEvents);
+    filterByPulseTimeHelper(*this->weightedEvents, start, stop, output.weightedEvents.access());
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterByPulseTime() called on an "
@@ -4222,7 +4246,7 @@ void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *out
  * @param output :: reference to an event list that will be output.
  */
 template <class T>
-void EventList::filterByPulseTimeHelper(std::vector<T> &events, DateAndTime start, DateAndTime stop,
+void EventList::filterByPulseTimeHelper(const std::vector<T> &events, DateAndTime start, DateAndTime stop,
                                         std::vector<T> &output) {
   std::copy_if(events.begin(), events.end(), std::back_inserter(output),
                [start, stop](const T &t) { return (t.m_pulsetime >= start) && (t.m_pulsetime < stop); });
@@ -4235,7 +4259,7 @@ void EventList::filterByPulseTimeHelper(std::vector<T> &events, DateAndTime star
  * @param output :: reference to an event list that will be output.
  */
 template <class T>
-void EventList::filterByTimeROIHelper(std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
+void EventList::filterByTimeROIHelper(const std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
                                       EventList *output) {
   // Iterate through the splitter at the same time
   auto itspl = intervals.cbegin();
@@ -4291,10 +4315,10 @@ void EventList::filterInPlace(Kernel::TimeROI const *timeRoi) {
   // Iterate through all events (sorted by pulse time)
   switch (eventType) {
   case TOF:
-    filterInPlaceHelper(timeRoi, *this->events);
+    filterInPlaceHelper(timeRoi, this->events.access());
     break;
   case WEIGHTED:
-    filterInPlaceHelper(timeRoi, *this->weightedEvents);
+    filterInPlaceHelper(timeRoi, this->weightedEvents.access());
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterInPlace() called on an "
@@ -4486,13 +4510,13 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid:
 
   switch (eventType) {
   case TOF:
-    convertUnitsViaTofHelper(*this->events, fromUnit, toUnit);
+    convertUnitsViaTofHelper(this->events.access(), fromUnit, toUnit);
     break;
   case WEIGHTED:
-    convertUnitsViaTofHelper(*this->weightedEvents, fromUnit, toUnit);
+    convertUnitsViaTofHelper(this->weightedEvents.access(), fromUnit, toUnit);
     break;
   case WEIGHTED_NOTIME:
-    convertUnitsViaTofHelper(*this->weightedEventsNoTime, fromUnit, toUnit);
+    convertUnitsViaTofHelper(this->weightedEventsNoTime.access(), fromUnit, toUnit);
     break;
   }
 }
@@ -4521,13 +4545,13 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events, const
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
   switch (eventType) {
   case TOF:
-    convertUnitsQuicklyHelper(*this->events, factor, power);
+    convertUnitsQuicklyHelper(this->events.access(), factor, power);
     break;
   case WEIGHTED:
-    convertUnitsQuicklyHelper(*this->weightedEvents, factor, power);
+    convertUnitsQuicklyHelper(this->weightedEvents.access(), factor, power);
     break;
   case WEIGHTED_NOTIME:
-    convertUnitsQuicklyHelper(*this->weightedEventsNoTime, factor, power);
+    convertUnitsQuicklyHelper(this->weightedEventsNoTime.access(), factor, power);
     break;
   }
 }
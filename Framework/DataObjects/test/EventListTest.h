@@ -223,6 +223,24 @@ public:
     TS_ASSERT_EQUALS(other.sharedDx(), el.sharedDx());
   }
 
+  void test_copy_shares_events_until_modified() {
+    const EventList copy(el);
+    const EventList &original = el;
+    TS_ASSERT_EQUALS(&copy.getEvents(), &original.getEvents());
+
+    el.getEvents()[0] = TofEvent(1, 2);
+    TS_ASSERT_DIFFERS(&copy.getEvents(), &original.getEvents());
+    TS_ASSERT_EQUALS(copy.getEvents()[0].tof(), 100);
+    TS_ASSERT_EQUALS(original.getEvents()[0].tof(), 1);
+  }
+
+  void test_sorting_a_copy_does_not_reorder_the_original() {
+    EventList copy(el);
+    copy.sortTof();
+    TS_ASSERT_EQUALS(copy.getEvents()[0].tof(), 3.5);
+    TS_ASSERT_EQUALS(el.getEvents()[0].tof(), 100);
+  }
+
   //==================================================================================
   //--- Plus Operators  ----
   //==================================================================================
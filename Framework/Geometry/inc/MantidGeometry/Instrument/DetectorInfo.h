@@ -105,6 +105,7 @@ public:
   Kernel::V3D sourcePosition() const;
   Kernel::V3D samplePosition() const;
   double l1() const;
+  size_t geometryVersion() const;
 
   const std::vector<detid_t> &detectorIDs() const;
   /// Returns the index of the detector with the given detector ID.
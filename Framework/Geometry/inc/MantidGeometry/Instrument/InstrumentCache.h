@@ -0,0 +1,38 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Instrument_fwd.h"
+
+#include <string>
+
+namespace Mantid {
+namespace Geometry {
+
+/** InstrumentCache : stores instruments built from an instrument definition
+ * file in a versioned binary file so that other sessions can rebuild them
+ * without parsing the XML again. Files written by another build of Mantid are
+ * ignored.
+ *
+ * The file holds the component tree, the shapes, the parameters and the
+ * logfile parameters of the instrument. Files are named after the mangled
+ * name of the definition, which contains a checksum of the XML, and are kept
+ * in the instrument geometry cache directory so they are shared by every
+ * process. Instruments that use component types without a binary form, such
+ * as rectangular or structured detectors, mesh shapes or a separate physical
+ * instrument, are not stored and are always parsed.
+ */
+namespace InstrumentCache {
+
+MANTID_GEOMETRY_DLL std::string filePath(const std::string &mangledName);
+MANTID_GEOMETRY_DLL bool save(const Instrument &instrument, const std::string &path);
+MANTID_GEOMETRY_DLL Instrument_sptr load(const std::string &path);
+
+} // namespace InstrumentCache
+} // namespace Geometry
+} // namespace Mantid
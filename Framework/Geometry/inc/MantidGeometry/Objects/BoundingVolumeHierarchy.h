@@ -0,0 +1,65 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class BoundingBox;
+
+/** BoundingVolumeHierarchy : a binary tree of axis-aligned boxes built over a
+ * list of bounding boxes, used to find the boxes that a ray passes through
+ * without testing every one of them.
+ *
+ * The tree is built once by splitting the boxes at the median of their centres
+ * along the longest axis until a few remain in each leaf. A query visits only
+ * the branches whose combined box is hit, so its cost grows with the logarithm
+ * of the number of boxes. Null boxes can not be placed in the tree and are
+ * returned by every query.
+ */
+class MANTID_GEOMETRY_DLL BoundingVolumeHierarchy {
+public:
+  BoundingVolumeHierarchy() = default;
+  explicit BoundingVolumeHierarchy(const std::vector<BoundingBox> &boxes);
+
+  void intersectingBoxes(const Kernel::V3D &startPoint, const Kernel::V3D &direction,
+                         std::vector<size_t> &indices) const;
+  /// @return the number of boxes the hierarchy was built from
+  size_t size() const { return m_items.size() + m_unbounded.size(); }
+
+private:
+  struct Item {
+    size_t index;
+    Kernel::V3D minPoint;
+    Kernel::V3D maxPoint;
+  };
+  struct Node {
+    Kernel::V3D minPoint;
+    Kernel::V3D maxPoint;
+    /// For a leaf the position of its first box in m_items, otherwise the
+    /// index of the second child. The first child always follows its parent.
+    uint32_t offset;
+    /// Number of boxes in a leaf, 0 for other nodes
+    uint32_t count;
+  };
+
+  void build(const size_t begin, const size_t end);
+
+  std::vector<Node> m_nodes;
+  /// The bounded input boxes in the order the leaves refer to them
+  std::vector<Item> m_items;
+  /// Indices of the null input boxes
+  std::vector<size_t> m_unbounded;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -31,6 +31,7 @@ class V3D;
 
 namespace Geometry {
 class CompGrp;
+class CompiledRule;
 class GeometryHandler;
 class Rule;
 class Surface;
@@ -74,6 +75,8 @@ public:
 
   /// Return the top rule
   const Rule *topRule() const { return m_topRule.get(); }
+  /// Return the flat form of the top rule used for point tests, or nullptr if there is none
+  const CompiledRule *compiledRule() const { return m_compiledRule.get(); }
   void setID(const std::string &id) override { m_id = id; }
   const std::string &id() const override { return m_id; }
 
@@ -102,6 +105,7 @@ public:
 
   bool isValid(const Kernel::V3D &) const override; ///< Check if a point is valid
   bool isValid(const std::map<int, int> &) const;   ///< Check if a set of surfaces are valid.
+  std::vector<bool> isValid(const std::vector<Kernel::V3D> &points) const; ///< Check if many points are valid
   bool isOnSide(const Kernel::V3D &) const override;
   Mantid::Geometry::TrackDirection calcValidType(const Kernel::V3D &Pt, const Kernel::V3D &uVec) const;
   Mantid::Geometry::TrackDirection calcValidTypeBy3Points(const Kernel::V3D &prePt, const Kernel::V3D &curPt,
@@ -133,6 +137,8 @@ public:
   double triangulatedSolidAngle(const SolidAngleParams &params, const Kernel::V3D &scaleFactor) const;
   // solid angle via ray tracing
   double rayTraceSolidAngle(const Kernel::V3D &observer) const;
+  // triangles whose solid angles facing an observer sum to the solid angle of a simple shape
+  std::vector<Kernel::V3D> solidAngleTriangles(const int numberOfCylinderSlices) const;
 
   /// Calculates the volume of this object.
   double volume() const override;
@@ -202,6 +208,8 @@ private:
   double singleShotMonteCarloVolume(const int shotSize, const size_t seed) const;
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> m_topRule;
+  /// Flat form of m_topRule for fast point tests, rebuilt by createSurfaceList and makeComplement
+  std::unique_ptr<CompiledRule> m_compiledRule;
   /// Object's bounding box
   BoundingBox m_boundingBox;
   // -- DEPRECATED --
@@ -0,0 +1,75 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidKernel/V3D.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+class Rule;
+class Surface;
+
+/** CompiledRule : a flat form of a CSG rule tree that classifies points
+ * without walking the tree of Rule objects through virtual calls.
+ *
+ * The rules are stored in pre-order and every node records where its subtree
+ * ends, so intersections and unions skip their second operand as soon as the
+ * first decides the result. Planes and spheres are held as arrays of their
+ * parameters and evaluated inline; other surfaces, and complements of other
+ * objects, are evaluated through their own classes. The result is the same
+ * as Rule::isValid for every point.
+ *
+ * The surfaces are referenced, not copied, so a CompiledRule must be rebuilt
+ * whenever its rule tree changes.
+ */
+class MANTID_GEOMETRY_DLL CompiledRule {
+public:
+  explicit CompiledRule(const Rule &rule);
+
+  bool isValid(const Kernel::V3D &point) const;
+  std::vector<bool> isValid(const std::vector<Kernel::V3D> &points) const;
+
+private:
+  enum class Operation : uint8_t { Intersection, Union, Complement, Surface, Rule, True, False };
+  enum class SurfaceType : uint8_t { Plane, Sphere, Other };
+  struct Node {
+    Operation operation;
+    /// +1 or -1 for a surface, the side that counts as inside
+    int8_t sign;
+    /// Index of the surface or of the rule evaluated by its own class
+    uint32_t item;
+    /// Index of the node following this node's subtree
+    uint32_t end;
+  };
+  struct SurfaceRef {
+    const Surface *surface;
+    SurfaceType type;
+    /// Index into the parameter arrays of planes or spheres
+    uint32_t index;
+  };
+
+  void compile(const Rule &rule);
+  uint32_t addSurface(const Surface &surface);
+  int side(const size_t surface, const Kernel::V3D &point) const;
+  template <typename SideFunction>
+  bool evaluate(const size_t node, const Kernel::V3D &point, const SideFunction &sideOf) const;
+
+  std::vector<Node> m_nodes;
+  std::vector<SurfaceRef> m_surfaces;
+  /// Planes: normal . point - distance
+  std::vector<double> m_planeNormalX, m_planeNormalY, m_planeNormalZ, m_planeDistance;
+  /// Spheres: |point - centre| - radius
+  std::vector<double> m_sphereCentreX, m_sphereCentreY, m_sphereCentreZ, m_sphereRadius;
+  std::vector<const Rule *> m_rules;
+};
+
+} // namespace Geometry
+} // namespace Mantid
@@ -9,6 +9,7 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
 #include "MantidGeometry/Objects/Track.h"
 #include <boost/unordered_map.hpp>
 #include <deque>
@@ -53,6 +54,10 @@ private:
   InstrumentRayTracer();
   /// Fire the given track at the instrument
   void fireRay(Track &testRay) const;
+  /// Find the bounding box of a component
+  BoundingBox boundingBox(const IComponent &component) const;
+  /// Find the hierarchy of bounding boxes of the children of an assembly
+  std::shared_ptr<const BoundingVolumeHierarchy> childHierarchy(const ICompAssembly &assembly) const;
 
   /// Pointer to the instrument
   Instrument_const_sptr m_instrument;
@@ -61,6 +66,8 @@ private:
   mutable Track m_resultsTrack;
   /// Map of component id -> bounding box.
   mutable boost::unordered_map<IComponent *, BoundingBox> m_boxCache;
+  /// Map of component id -> hierarchy of the bounding boxes of its children
+  mutable boost::unordered_map<ComponentID, std::shared_ptr<const BoundingVolumeHierarchy>> m_hierarchyCache;
   /// Mutex to lock box cache
   mutable std::mutex m_mutex;
 };
@@ -11,6 +11,7 @@
 //----------------------------------------------------------------------
 #include "BoundingBox.h"
 #include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Rendering/ShapeInfo.h"
@@ -49,6 +50,10 @@ Mesh Object of Triangles assumed to form one or more
 non-intersecting closed surfaces enclosing separate volumes.
 The number of vertices is limited to 2^32 based on index type. For 2D Meshes see
 Mesh2DObject
+
+The bounding boxes of the triangles are placed in a bounding volume hierarchy
+when the mesh is created or transformed, so that a ray is only tested against
+the triangles whose boxes it passes through.
 */
 class MANTID_GEOMETRY_DLL MeshObject : public IObject {
 public:
@@ -81,6 +86,7 @@ public:
   bool hasValidShape() const override;
 
   bool isValid(const Kernel::V3D &) const override; ///< Check if a point is inside
+  std::vector<bool> isValid(const std::vector<Kernel::V3D> &points) const;
   bool isOnSide(const Kernel::V3D &) const override;
   int calcValidType(const Kernel::V3D &Pt, const Kernel::V3D &uVec) const;
 
@@ -149,10 +155,15 @@ public:
 
 private:
   void initialize();
+  void verticesChanged();
+  bool isValid(const Kernel::V3D &point, std::vector<Kernel::V3D> &intersectionPoints,
+               std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
   /// Get intersections
   void getIntersections(const Kernel::V3D &start, const Kernel::V3D &direction,
                         std::vector<Kernel::V3D> &intersectionPoints,
                         std::vector<Mantid::Geometry::TrackDirection> &entryExitFlags) const;
+  /// Get the triangles a ray may intersect
+  std::vector<size_t> candidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction) const;
 
   /// Get triangle
   bool getTriangle(const size_t index, Kernel::V3D &v1, Kernel::V3D &v2, Kernel::V3D &v3) const;
@@ -183,6 +194,8 @@ private:
   /// Triangles are specified by indices into a list of vertices.
   std::vector<uint32_t> m_triangles;
   std::vector<Kernel::V3D> m_vertices;
+  /// Bounding boxes of the triangles, indexed as the triangles
+  BoundingVolumeHierarchy m_triangleHierarchy;
   /// material composition
   Kernel::Material m_material;
 };
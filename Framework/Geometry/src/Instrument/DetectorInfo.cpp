@@ -432,6 +432,10 @@ Kernel::V3D DetectorInfo::samplePosition() const { return Kernel::toV3D(m_detect
 /// Returns L1 (distance from source to sample).
 double DetectorInfo::l1() const { return m_detectorInfo->l1(); }
 
+/// Returns a number that changes whenever the detector, source or sample
+/// positions or rotations change. See Beamline::DetectorInfo::geometryVersion.
+size_t DetectorInfo::geometryVersion() const { return m_detectorInfo->geometryVersion(); }
+
 /// Returns a sorted vector of all detector IDs.
 const std::vector<detid_t> &DetectorInfo::detectorIDs() const { return *m_detectorIDs; }
 
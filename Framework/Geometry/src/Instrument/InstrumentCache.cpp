@@ -0,0 +1,557 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/CompAssembly.h"
+#include "MantidGeometry/Instrument/Component.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/FitParameter.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/ObjComponent.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/BinaryStreamReader.h"
+#include "MantidKernel/BinaryStreamWriter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Interpolation.h"
+#include "MantidKernel/Logger.h"
+#include "MantidKernel/MantidVersion.h"
+
+#include <Poco/Process.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <typeinfo>
+#include <unordered_map>
+
+using Mantid::Kernel::BinaryStreamReader;
+using Mantid::Kernel::BinaryStreamWriter;
+using Mantid::Kernel::Quat;
+using Mantid::Kernel::V2D;
+using Mantid::Kernel::V3D;
+
+namespace Mantid::Geometry::InstrumentCache {
+
+namespace {
+Kernel::Logger g_log("InstrumentCache");
+
+/// Identifies the files, followed by the format version and the build that wrote them
+const std::string MAGIC = "MantidInstrumentCache";
+/// Increase whenever the layout of the file changes
+constexpr uint32_t FORMAT_VERSION = 2;
+/// Written last so that truncated files are rejected
+const std::string END_MARKER = "EndOfInstrument";
+
+enum class ComponentType : int32_t { Instrument, Component, CompAssembly, ObjComponent, ObjCompAssembly, Detector };
+enum class DetectorState : int32_t { Unmarked, Detector, Monitor };
+
+/// @return the type tag of a component, or nothing if it has no binary form
+std::optional<ComponentType> componentType(const IComponent &component) {
+  const auto &type = typeid(component);
+  if (type == typeid(Instrument))
+    return ComponentType::Instrument;
+  if (type == typeid(Component))
+    return ComponentType::Component;
+  if (type == typeid(CompAssembly))
+    return ComponentType::CompAssembly;
+  if (type == typeid(ObjComponent))
+    return ComponentType::ObjComponent;
+  if (type == typeid(ObjCompAssembly))
+    return ComponentType::ObjCompAssembly;
+  if (type == typeid(Detector))
+    return ComponentType::Detector;
+  return std::nullopt;
+}
+
+PointingAlong pointingAlong(const V3D &direction) {
+  if (direction.X() != 0.)
+    return X;
+  return direction.Y() != 0. ? Y : Z;
+}
+
+void writeV3D(BinaryStreamWriter &writer, const V3D &vector) { writer << vector.X() << vector.Y() << vector.Z(); }
+
+V3D readV3D(BinaryStreamReader &reader) {
+  double x, y, z;
+  reader >> x >> y >> z;
+  return V3D(x, y, z);
+}
+
+void writeQuat(BinaryStreamWriter &writer, const Quat &rotation) {
+  writer << rotation.real() << rotation.imagI() << rotation.imagJ() << rotation.imagK();
+}
+
+Quat readQuat(BinaryStreamReader &reader) {
+  double w, a, b, c;
+  reader >> w >> a >> b >> c;
+  return Quat(w, a, b, c);
+}
+
+/// @return the build of Mantid that writes the files. The parser of the definition may change between builds
+/// without a change to the layout of the file, so files written by other builds are not used.
+std::string buildVersion() {
+  return Kernel::MantidVersion::version() + " " + Kernel::MantidVersion::revisionFull();
+}
+
+std::string interpolationToString(const Kernel::Interpolation &interpolation) {
+  std::ostringstream os;
+  os << std::setprecision(std::numeric_limits<double>::max_digits10) << interpolation;
+  return os.str();
+}
+
+/** Write the value of a parameter. Floating point values are written in
+ * binary, or as text with enough digits to read back the same bits, because
+ * Parameter::asString rounds them.
+ */
+void writeParameterValue(BinaryStreamWriter &writer, Parameter &parameter) {
+  const auto &type = parameter.type();
+  if (type == ParameterMap::pDouble()) {
+    writer << parameter.value<double>();
+  } else if (type == ParameterMap::pV3D()) {
+    writeV3D(writer, parameter.value<V3D>());
+  } else if (type == ParameterMap::pQuat()) {
+    writeQuat(writer, parameter.value<Quat>());
+  } else if (type == "fitting") {
+    std::ostringstream os;
+    os << std::setprecision(std::numeric_limits<double>::max_digits10) << parameter.value<FitParameter>();
+    writer << os.str();
+  } else {
+    writer << parameter.asString();
+  }
+}
+
+/// The parts of an instrument that are written to a file, in the order they are written
+struct Contents {
+  std::vector<const IComponent *> components;
+  std::unordered_map<const IComponent *, int32_t> componentIndices;
+  std::vector<std::shared_ptr<const CSGObject>> shapes;
+  std::unordered_map<const IObject *, int32_t> shapeIndices;
+
+  /// @return the index of a component, throwing if it is not part of the instrument
+  int32_t indexOf(const IComponent *component) const {
+    const auto found = componentIndices.find(component);
+    if (found == componentIndices.end())
+      throw std::runtime_error("refers to a component outside of the instrument tree");
+    return found->second;
+  }
+};
+
+/** Collect the components and shapes of an instrument, depth first so that
+ * every parent precedes its children.
+ * @return false if the instrument holds something that has no binary form
+ */
+bool collect(const IComponent *component, Contents &contents) {
+  if (!componentType(*component)) {
+    g_log.debug() << "Component " << component->getFullName() << " of type " << component->type()
+                  << " can not be cached.\n";
+    return false;
+  }
+  contents.componentIndices.emplace(component, static_cast<int32_t>(contents.components.size()));
+  contents.components.emplace_back(component);
+
+  if (const auto *objComponent = dynamic_cast<const ObjComponent *>(component)) {
+    const auto shape = objComponent->shape();
+    if (shape && contents.shapeIndices.count(shape.get()) == 0) {
+      auto csgShape = std::dynamic_pointer_cast<const CSGObject>(shape);
+      // shapes are rebuilt from their XML, which only empty shapes may lack
+      if (!csgShape || (csgShape->getShapeXML().empty() && csgShape->hasValidShape())) {
+        g_log.debug() << "The shape of " << component->getFullName() << " can not be cached.\n";
+        return false;
+      }
+      contents.shapeIndices.emplace(shape.get(), static_cast<int32_t>(contents.shapes.size()));
+      contents.shapes.emplace_back(std::move(csgShape));
+    }
+  }
+  if (const auto *assembly = dynamic_cast<const ICompAssembly *>(component)) {
+    for (int i = 0; i < assembly->nelements(); ++i) {
+      if (!collect(assembly->getChild(i).get(), contents))
+        return false;
+    }
+  }
+  return true;
+}
+
+void writeInstrument(BinaryStreamWriter &writer, const Instrument &instrument, const Contents &contents) {
+  writer.write(MAGIC, MAGIC.size());
+  writer << FORMAT_VERSION << buildVersion();
+  writer << instrument.getName() << instrument.getDefaultView() << instrument.getDefaultAxis();
+  writer << instrument.getValidFromDate().totalNanoseconds() << instrument.getValidToDate().totalNanoseconds();
+
+  const auto frame = instrument.getReferenceFrame();
+  writer << static_cast<int32_t>(frame->pointingUp()) << static_cast<int32_t>(frame->pointingAlongBeam())
+         << static_cast<int32_t>(pointingAlong(frame->vecThetaSign())) << static_cast<int32_t>(frame->getHandedness())
+         << frame->origin();
+
+  const auto &units = instrument.getLogfileUnit();
+  writer << static_cast<uint32_t>(units.size());
+  for (const auto &[unit, value] : units)
+    writer << unit << value;
+
+  writer << static_cast<uint32_t>(contents.shapes.size());
+  for (const auto &shape : contents.shapes)
+    writer << shape->id() << shape->getShapeXML();
+
+  detid2det_map detectors;
+  instrument.getDetectors(detectors);
+  writer << static_cast<uint32_t>(contents.components.size());
+  for (const auto *component : contents.components) {
+    writer << static_cast<int32_t>(*componentType(*component));
+    const auto parent = component->getParent();
+    writer << (parent ? contents.indexOf(parent.get()) : int32_t{-1});
+    writer << component->getName();
+    writeV3D(writer, component->getRelativePos());
+    writeQuat(writer, component->getRelativeRot());
+    const auto sideBySide = component->getSideBySideViewPos();
+    writer << static_cast<int32_t>(sideBySide.has_value());
+    if (sideBySide)
+      writer << sideBySide->X() << sideBySide->Y();
+
+    if (const auto *objComponent = dynamic_cast<const ObjComponent *>(component)) {
+      const auto shape = objComponent->shape();
+      writer << (shape ? contents.shapeIndices.at(shape.get()) : int32_t{-1});
+    }
+    if (const auto *detector = dynamic_cast<const Detector *>(component)) {
+      auto state = DetectorState::Unmarked;
+      const auto marked = detectors.find(detector->getID());
+      if (marked != detectors.end() && marked->second.get() == detector)
+        state = instrument.isMonitor(detector->getID()) ? DetectorState::Monitor : DetectorState::Detector;
+      writer << static_cast<int32_t>(detector->getID()) << static_cast<int32_t>(state);
+    }
+  }
+  writer << (instrument.hasSource() ? contents.indexOf(instrument.getSource().get()) : int32_t{-1});
+  writer << (instrument.hasSample() ? contents.indexOf(instrument.getSample().get()) : int32_t{-1});
+
+  const auto parameters = instrument.getParameterMap();
+  writer << static_cast<uint32_t>(parameters->size());
+  for (auto it = parameters->begin(); it != parameters->end(); ++it) {
+    const auto &parameter = it->second;
+    writer << contents.indexOf(it->first) << parameter->type() << parameter->name() << parameter->getDescription()
+           << static_cast<int32_t>(parameter->visible());
+    writeParameterValue(writer, *parameter);
+  }
+
+  const auto &logfileCache = instrument.getLogfileCache();
+  writer << static_cast<uint32_t>(logfileCache.size());
+  for (const auto &[key, parameter] : logfileCache) {
+    writer << key.first << contents.indexOf(key.second);
+    writer << parameter->m_logfileID << parameter->m_value << parameter->m_paramName << parameter->m_type
+           << parameter->m_tie << static_cast<uint32_t>(parameter->m_constraint.size());
+    for (const auto &constraint : parameter->m_constraint)
+      writer << constraint;
+    writer << parameter->m_penaltyFactor << parameter->m_fittingFunction << parameter->m_formula
+           << parameter->m_formulaUnit << parameter->m_resultUnit;
+    writer << static_cast<int32_t>(parameter->m_interpolation != nullptr);
+    if (parameter->m_interpolation)
+      writer << interpolationToString(*parameter->m_interpolation);
+    writer << parameter->m_extractSingleValueAs << parameter->m_eq << contents.indexOf(parameter->m_component)
+           << parameter->m_angleConvertConst << parameter->m_description << parameter->m_visible;
+  }
+  writer << END_MARKER;
+}
+
+/// Reads the values written by writeInstrument, throwing if the file is not usable
+class InstrumentReader {
+public:
+  explicit InstrumentReader(std::istream &stream) : m_stream(stream), m_reader(stream) {}
+
+  Instrument_sptr read() {
+    std::string magic;
+    uint32_t version;
+    m_reader.read(magic, MAGIC.size());
+    if (magic != MAGIC)
+      throw std::runtime_error("not an instrument cache file");
+    m_reader >> version;
+    if (version != FORMAT_VERSION)
+      throw std::runtime_error("written with format version " + std::to_string(version));
+    const auto build = readString();
+    if (build != buildVersion())
+      throw std::runtime_error("written by Mantid " + build);
+
+    auto instrument = std::make_shared<Instrument>(readString());
+    instrument->setDefaultView(readString());
+    instrument->setDefaultViewAxis(readString());
+    instrument->setValidFromDate(Types::Core::DateAndTime(readValue<int64_t>()));
+    instrument->setValidToDate(Types::Core::DateAndTime(readValue<int64_t>()));
+
+    const auto up = static_cast<PointingAlong>(readValue<int32_t>());
+    const auto alongBeam = static_cast<PointingAlong>(readValue<int32_t>());
+    const auto thetaSign = static_cast<PointingAlong>(readValue<int32_t>());
+    const auto handedness = static_cast<Handedness>(readValue<int32_t>());
+    instrument->setReferenceFrame(
+        std::make_shared<ReferenceFrame>(up, alongBeam, thetaSign, handedness, readString()));
+
+    auto &units = instrument->getLogfileUnit();
+    const auto numUnits = readValue<uint32_t>();
+    for (uint32_t i = 0; i < numUnits; ++i) {
+      auto unit = readString();
+      units[unit] = readString();
+    }
+
+    readShapes();
+    readComponents(*instrument);
+    const auto source = readValue<int32_t>();
+    if (source >= 0)
+      instrument->markAsSource(component(source));
+    const auto sample = readValue<int32_t>();
+    if (sample >= 0)
+      instrument->markAsSamplePos(component(sample));
+
+    readParameters(*instrument->getParameterMap());
+    readLogfileCache(instrument->getLogfileCache());
+    if (readString() != END_MARKER || m_stream.fail())
+      throw std::runtime_error("the file is truncated");
+    return instrument;
+  }
+
+private:
+  template <typename T> T readValue() {
+    T value;
+    m_reader >> value;
+    if (m_stream.fail())
+      throw std::runtime_error("the file is truncated");
+    return value;
+  }
+
+  std::string readString() { return readValue<std::string>(); }
+
+  IComponent *component(const int32_t index) const {
+    if (index < 0 || static_cast<size_t>(index) >= m_components.size())
+      throw std::runtime_error("invalid component index " + std::to_string(index));
+    return m_components[index];
+  }
+
+  std::shared_ptr<IObject> shape(const int32_t index) const {
+    if (index < 0)
+      return nullptr;
+    if (static_cast<size_t>(index) >= m_shapes.size())
+      throw std::runtime_error("invalid shape index " + std::to_string(index));
+    return m_shapes[index];
+  }
+
+  void readShapes() {
+    ShapeFactory shapeFactory;
+    const auto numShapes = readValue<uint32_t>();
+    m_shapes.reserve(numShapes);
+    for (uint32_t i = 0; i < numShapes; ++i) {
+      const auto id = readString();
+      const auto xml = readString();
+      auto shape = xml.empty() ? std::make_shared<CSGObject>() : shapeFactory.createShape(xml, false);
+      shape->setID(id);
+      m_shapes.emplace_back(std::move(shape));
+    }
+  }
+
+  void readComponents(Instrument &instrument) {
+    const auto numComponents = readValue<uint32_t>();
+    m_components.reserve(numComponents);
+    for (uint32_t i = 0; i < numComponents; ++i) {
+      const auto type = static_cast<ComponentType>(readValue<int32_t>());
+      const auto parentIndex = readValue<int32_t>();
+      if ((i == 0) != (type == ComponentType::Instrument) || (i == 0) != (parentIndex < 0))
+        throw std::runtime_error("the instrument must be the first component and the only one without a parent");
+      const auto name = readString();
+      const auto position = readV3D(m_reader);
+      const auto rotation = readQuat(m_reader);
+      std::optional<V2D> sideBySide;
+      if (readValue<int32_t>() != 0) {
+        const auto x = readValue<double>();
+        sideBySide = V2D(x, readValue<double>());
+      }
+
+      std::unique_ptr<IComponent> created;
+      const Detector *detector = nullptr;
+      auto detectorState = DetectorState::Unmarked;
+      switch (type) {
+      case ComponentType::Instrument:
+        break;
+      case ComponentType::Component:
+        created = std::make_unique<Component>(name);
+        break;
+      case ComponentType::CompAssembly:
+        created = std::make_unique<CompAssembly>(name);
+        break;
+      case ComponentType::ObjComponent:
+        created = std::make_unique<ObjComponent>(name, shape(readValue<int32_t>()));
+        break;
+      case ComponentType::ObjCompAssembly: {
+        const auto outline = shape(readValue<int32_t>());
+        auto assembly = std::make_unique<ObjCompAssembly>(name);
+        assembly->setOutline(outline);
+        created = std::move(assembly);
+        break;
+      }
+      case ComponentType::Detector: {
+        const auto detectorShape = shape(readValue<int32_t>());
+        const auto id = readValue<int32_t>();
+        detectorState = static_cast<DetectorState>(readValue<int32_t>());
+        auto newDetector = std::make_unique<Detector>(name, id, detectorShape, nullptr);
+        detector = newDetector.get();
+        created = std::move(newDetector);
+        break;
+      }
+      default:
+        throw std::runtime_error("unknown component type");
+      }
+
+      IComponent *added = &instrument;
+      if (created) {
+        auto *parent = dynamic_cast<ICompAssembly *>(component(parentIndex));
+        if (!parent)
+          throw std::runtime_error("the parent of " + name + " is not an assembly");
+        parent->add(created.get());
+        added = created.release();
+      }
+      added->setPos(position);
+      added->setRot(rotation);
+      if (sideBySide)
+        added->setSideBySideViewPos(*sideBySide);
+      if (detectorState == DetectorState::Monitor)
+        instrument.markAsMonitorIncomplete(detector);
+      else if (detectorState == DetectorState::Detector)
+        instrument.markAsDetectorIncomplete(detector);
+      m_components.emplace_back(added);
+    }
+    instrument.markAsDetectorFinalize();
+  }
+
+  void readParameters(ParameterMap &parameters) {
+    const auto numParameters = readValue<uint32_t>();
+    for (uint32_t i = 0; i < numParameters; ++i) {
+      const auto *owner = component(readValue<int32_t>());
+      const auto type = readString();
+      const auto name = readString();
+      const auto description = readString();
+      const auto *const pDescription = description.empty() ? nullptr : &description;
+      const std::string visible = readValue<int32_t>() != 0 ? "true" : "false";
+      if (type == ParameterMap::pDouble())
+        parameters.add(type, owner, name, readValue<double>(), pDescription, visible);
+      else if (type == ParameterMap::pV3D())
+        parameters.add(type, owner, name, readV3D(m_reader), pDescription, visible);
+      else if (type == ParameterMap::pQuat())
+        parameters.add(type, owner, name, readQuat(m_reader), pDescription, visible);
+      else
+        parameters.add(type, owner, name, readString(), pDescription, visible);
+    }
+  }
+
+  void readLogfileCache(InstrumentParameterCache &logfileCache) {
+    const auto numParameters = readValue<uint32_t>();
+    for (uint32_t i = 0; i < numParameters; ++i) {
+      auto key = std::make_pair(readString(), static_cast<const IComponent *>(component(readValue<int32_t>())));
+      const auto logfileID = readString();
+      const auto value = readString();
+      const auto paramName = readString();
+      const auto type = readString();
+      const auto tie = readString();
+      std::vector<std::string> constraint(readValue<uint32_t>());
+      for (auto &bound : constraint)
+        bound = readString();
+      auto penaltyFactor = readString();
+      const auto fittingFunction = readString();
+      const auto formula = readString();
+      const auto formulaUnit = readString();
+      const auto resultUnit = readString();
+      std::shared_ptr<Kernel::Interpolation> interpolation;
+      if (readValue<int32_t>() != 0) {
+        interpolation = std::make_shared<Kernel::Interpolation>();
+        std::istringstream interpolationStream(readString());
+        interpolationStream >> *interpolation;
+      }
+      const auto extractSingleValueAs = readString();
+      const auto eq = readString();
+      const auto *owner = component(readValue<int32_t>());
+      const auto angleConvertConst = readValue<double>();
+      const auto description = readString();
+      const auto visible = readString();
+      auto parameter = std::make_shared<XMLInstrumentParameter>(
+          logfileID, value, interpolation, formula, formulaUnit, resultUnit, paramName, type, tie, constraint,
+          penaltyFactor, fittingFunction, extractSingleValueAs, eq, owner, angleConvertConst, description, visible);
+      logfileCache.emplace(std::move(key), std::move(parameter));
+    }
+  }
+
+  std::istream &m_stream;
+  BinaryStreamReader m_reader;
+  std::vector<IComponent *> m_components;
+  std::vector<std::shared_ptr<IObject>> m_shapes;
+};
+} // namespace
+
+/** Find where the cached copy of an instrument definition is kept.
+ * @param mangledName :: the mangled name of the definition, which includes a
+ * checksum of its XML
+ * @return the path of the file, or an empty string if the
+ * instrumentDefinition.binaryCache setting turns the cache off
+ */
+std::string filePath(const std::string &mangledName) {
+  auto &config = Kernel::ConfigService::Instance();
+  if (mangledName.empty() || !config.getValue<bool>("instrumentDefinition.binaryCache").value_or(false))
+    return "";
+  return (std::filesystem::path(config.getVTPFileDirectory()) / (mangledName + ".instrument")).string();
+}
+
+/** Write an instrument to a cache file. The file is written under a temporary
+ * name and then renamed so that other processes never read a partial file.
+ * @param instrument :: a base instrument that has just been built
+ * @param path :: the file to write
+ * @return true if the file was written, false if the instrument can not be
+ * stored or writing failed
+ */
+bool save(const Instrument &instrument, const std::string &path) {
+  if (path.empty() || instrument.isParametrized() || instrument.getPhysicalInstrument())
+    return false;
+  Contents contents;
+  if (!collect(&instrument, contents))
+    return false;
+
+  const std::string partialPath = path + "." + std::to_string(Poco::Process::id()) + ".part";
+  try {
+    {
+      std::ofstream file(partialPath, std::ios::binary | std::ios::trunc);
+      BinaryStreamWriter writer(file);
+      writeInstrument(writer, instrument, contents);
+      if (file.fail())
+        throw std::runtime_error("unable to write " + partialPath);
+    }
+    std::filesystem::rename(partialPath, path);
+  } catch (std::exception &e) {
+    g_log.warning() << "Unable to cache instrument " << instrument.getName() << " in " << path << ": " << e.what()
+                    << '\n';
+    std::error_code ignored;
+    std::filesystem::remove(partialPath, ignored);
+    return false;
+  }
+  g_log.debug() << "Cached instrument " << instrument.getName() << " in " << path << '\n';
+  return true;
+}
+
+/** Rebuild an instrument from a cache file. The file name and XML text of the
+ * definition are not stored and have to be set by the caller.
+ * @param path :: the file written by save()
+ * @return the instrument, or nullptr if there is no usable file
+ */
+Instrument_sptr load(const std::string &path) {
+  if (path.empty())
+    return nullptr;
+  std::ifstream file(path, std::ios::binary);
+  if (!file)
+    return nullptr;
+  try {
+    return InstrumentReader(file).read();
+  } catch (std::exception &e) {
+    g_log.warning() << "Ignoring the instrument cache file " << path << ": " << e.what() << '\n';
+    return nullptr;
+  }
+}
+
+} // namespace Mantid::Geometry::InstrumentCache
@@ -0,0 +1,152 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Mantid::Geometry {
+
+using Kernel::V3D;
+
+namespace {
+/// Largest number of boxes kept in a leaf
+constexpr size_t MAX_LEAF_SIZE = 4;
+
+/** Test whether a ray passes through an axis-aligned box, padded by the
+ * tolerance so that rays grazing an edge are not missed.
+ * @param minPoint :: the lower corner of the box
+ * @param maxPoint :: the upper corner of the box
+ * @param startPoint :: the start of the ray
+ * @param direction :: the direction of the ray
+ * @return true if any point of the ray at or beyond its start is inside the box
+ */
+bool rayHitsBox(const V3D &minPoint, const V3D &maxPoint, const V3D &startPoint, const V3D &direction) {
+  const double tol = Kernel::Tolerance;
+  double tNear = 0.;
+  double tFar = std::numeric_limits<double>::max();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const double lower = minPoint[axis] - tol;
+    const double upper = maxPoint[axis] + tol;
+    if (std::abs(direction[axis]) < tol) {
+      if (startPoint[axis] < lower || startPoint[axis] > upper)
+        return false;
+      continue;
+    }
+    double t1 = (lower - startPoint[axis]) / direction[axis];
+    double t2 = (upper - startPoint[axis]) / direction[axis];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tNear = std::max(tNear, t1);
+    tFar = std::min(tFar, t2);
+    if (tNear > tFar)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+/** Build the hierarchy.
+ * @param boxes :: the boxes to place in it. Queries return indices into this
+ * vector.
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const std::vector<BoundingBox> &boxes) {
+  m_items.reserve(boxes.size());
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const auto &box = boxes[i];
+    if (box.isNull())
+      m_unbounded.emplace_back(i);
+    else
+      m_items.emplace_back(Item{i, box.minPoint(), box.maxPoint()});
+  }
+  if (m_items.empty())
+    return;
+  m_nodes.reserve(2 * m_items.size() / MAX_LEAF_SIZE + 1);
+  build(0, m_items.size());
+}
+
+/** Find the boxes that a ray passes through. Boxes are tested with a small
+ * tolerance, so a box the ray only just misses may also be returned.
+ * @param startPoint :: the start of the ray
+ * @param direction :: the direction of the ray
+ * @param indices :: the indices of the boxes that are hit are appended to
+ * this, in no particular order
+ */
+void BoundingVolumeHierarchy::intersectingBoxes(const V3D &startPoint, const V3D &direction,
+                                                std::vector<size_t> &indices) const {
+  indices.insert(indices.end(), m_unbounded.cbegin(), m_unbounded.cend());
+  if (m_nodes.empty())
+    return;
+
+  std::vector<uint32_t> stack{0};
+  while (!stack.empty()) {
+    const auto &node = m_nodes[stack.back()];
+    const auto nodeIndex = stack.back();
+    stack.pop_back();
+    if (!rayHitsBox(node.minPoint, node.maxPoint, startPoint, direction))
+      continue;
+    if (node.count > 0) {
+      for (auto i = node.offset; i < node.offset + node.count; ++i) {
+        const auto &item = m_items[i];
+        if (rayHitsBox(item.minPoint, item.maxPoint, startPoint, direction))
+          indices.emplace_back(item.index);
+      }
+    } else {
+      stack.emplace_back(node.offset);
+      stack.emplace_back(nodeIndex + 1);
+    }
+  }
+}
+
+/** Add the node holding a range of boxes and the nodes below it, reordering
+ * the boxes so that every leaf refers to a contiguous range.
+ * @param begin :: the first box of the node
+ * @param end :: one past the last box of the node
+ */
+void BoundingVolumeHierarchy::build(const size_t begin, const size_t end) {
+  // the centres of the boxes are compared at twice their size to save a division
+  const auto twiceCentre = [](const Item &item) { return item.minPoint + item.maxPoint; };
+  V3D minPoint = m_items[begin].minPoint;
+  V3D maxPoint = m_items[begin].maxPoint;
+  V3D minCentre = twiceCentre(m_items[begin]);
+  V3D maxCentre = minCentre;
+  for (size_t i = begin + 1; i < end; ++i) {
+    const V3D centre = twiceCentre(m_items[i]);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      minPoint[axis] = std::min(minPoint[axis], m_items[i].minPoint[axis]);
+      maxPoint[axis] = std::max(maxPoint[axis], m_items[i].maxPoint[axis]);
+      minCentre[axis] = std::min(minCentre[axis], centre[axis]);
+      maxCentre[axis] = std::max(maxCentre[axis], centre[axis]);
+    }
+  }
+
+  const auto nodeIndex = m_nodes.size();
+  m_nodes.emplace_back(Node{minPoint, maxPoint, static_cast<uint32_t>(begin), static_cast<uint32_t>(end - begin)});
+  if (end - begin <= MAX_LEAF_SIZE)
+    return;
+
+  // split at the median centre along the axis the centres are most spread over
+  const V3D extent = maxCentre - minCentre;
+  size_t axis = extent.X() > extent.Y() ? 0 : 1;
+  if (extent.Z() > extent[axis])
+    axis = 2;
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(m_items.begin() + begin, m_items.begin() + middle, m_items.begin() + end,
+                   [axis](const Item &lhs, const Item &rhs) {
+                     return lhs.minPoint[axis] + lhs.maxPoint[axis] < rhs.minPoint[axis] + rhs.maxPoint[axis];
+                   });
+
+  m_nodes[nodeIndex].count = 0;
+  build(begin, middle);
+  m_nodes[nodeIndex].offset = static_cast<uint32_t>(m_nodes.size());
+  build(middle, end);
+}
+
+} // namespace Mantid::Geometry
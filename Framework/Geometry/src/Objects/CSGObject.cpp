@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/CompiledRule.h"
 
 #include "MantidGeometry/Objects/Rules.h"
 #include "MantidGeometry/Objects/Track.h"
@@ -217,95 +218,88 @@ double coneSolidAngle(const V3D &observer, const Mantid::Kernel::V3D &centre, co
 }
 
 /**
- * Get the solid angle of a cuboid defined by 4 points. Simple use of triangle
- * based solid angle
- * calculation. Should work for parallel-piped as well.
+ * Sum the solid angles of the triangles that face an observer. Triangles facing
+ * away from the observer give a negative solid angle and are excluded.
+ * @param triangles :: the vertices of the triangles, three per triangle
  * @param observer :: point from which solid angle required
+ * @return :: the solid angle of the triangles facing the observer
+ */
+double positiveSolidAngle(const std::vector<V3D> &triangles, const V3D &observer) {
+  double sangle = 0.0;
+  for (size_t i = 0; i + 2 < triangles.size(); i += 3) {
+    const double sa = triangleSolidAngle(triangles[i], triangles[i + 1], triangles[i + 2], observer);
+    if (sa > 0.0)
+      sangle += sa;
+  }
+  return sangle;
+}
+
+/**
+ * Get the triangles used for the solid angle of a cuboid defined by 4 points.
+ * Should work for parallel-piped as well.
  * @param vectors :: vector of V3D - the values are the 4 points used to defined
  * the cuboid
- * @return :: solid angle of cuboid - good accuracy
+ * @return :: the vertices of the 12 bounding triangles, three per triangle
  */
-double cuboidSolidAngle(const V3D &observer, const std::vector<V3D> &vectors) {
+std::vector<V3D> cuboidSolidAngleTriangles(const std::vector<V3D> &vectors) {
   // Build bounding points, then set up map of 12 bounding
   // triangles defining the 6 surfaces of the bounding box. Using a consistent
   // ordering of points the "away facing" triangles give -ve contributions to
   // the solid angle and hence are ignored.
-  std::vector<V3D> pts;
-  pts.reserve(8);
   const V3D dx = vectors[1] - vectors[0];
   const V3D dz = vectors[3] - vectors[0];
-  pts.emplace_back(vectors[2]);
-  pts.emplace_back(vectors[2] + dx);
-  pts.emplace_back(vectors[1]);
-  pts.emplace_back(vectors[0]);
-  pts.emplace_back(vectors[2] + dz);
-  pts.emplace_back(vectors[2] + dz + dx);
-  pts.emplace_back(vectors[1] + dz);
-  pts.emplace_back(vectors[0] + dz);
-
-  constexpr unsigned int ntriangles(12);
-  std::vector<std::vector<int>> triMap(ntriangles, std::vector<int>(3, 0));
-  triMap[0][0] = 1;
-  triMap[0][1] = 4;
-  triMap[0][2] = 3;
-  triMap[1][0] = 3;
-  triMap[1][1] = 2;
-  triMap[1][2] = 1;
-  triMap[2][0] = 5;
-  triMap[2][1] = 6;
-  triMap[2][2] = 7;
-  triMap[3][0] = 7;
-  triMap[3][1] = 8;
-  triMap[3][2] = 5;
-  triMap[4][0] = 1;
-  triMap[4][1] = 2;
-  triMap[4][2] = 6;
-  triMap[5][0] = 6;
-  triMap[5][1] = 5;
-  triMap[5][2] = 1;
-  triMap[6][0] = 2;
-  triMap[6][1] = 3;
-  triMap[6][2] = 7;
-  triMap[7][0] = 7;
-  triMap[7][1] = 6;
-  triMap[7][2] = 2;
-  triMap[8][0] = 3;
-  triMap[8][1] = 4;
-  triMap[8][2] = 8;
-  triMap[9][0] = 8;
-  triMap[9][1] = 7;
-  triMap[9][2] = 3;
-  triMap[10][0] = 1;
-  triMap[10][1] = 5;
-  triMap[10][2] = 8;
-  triMap[11][0] = 8;
-  triMap[11][1] = 4;
-  triMap[11][2] = 1;
-  double sangle = 0.0;
-  for (unsigned int i = 0; i < ntriangles; i++) {
-    const double sa = triangleSolidAngle(pts[triMap[i][0] - 1], pts[triMap[i][1] - 1], pts[triMap[i][2] - 1], observer);
-    if (sa > 0)
-      sangle += sa;
+  const std::array<V3D, 8> pts{vectors[2],      vectors[2] + dx,      vectors[1],      vectors[0],
+                               vectors[2] + dz, vectors[2] + dz + dx, vectors[1] + dz, vectors[0] + dz};
+
+  constexpr std::array<std::array<int, 3>, 12> triMap{{{1, 4, 3},
+                                                       {3, 2, 1},
+                                                       {5, 6, 7},
+                                                       {7, 8, 5},
+                                                       {1, 2, 6},
+                                                       {6, 5, 1},
+                                                       {2, 3, 7},
+                                                       {7, 6, 2},
+                                                       {3, 4, 8},
+                                                       {8, 7, 3},
+                                                       {1, 5, 8},
+                                                       {8, 4, 1}}};
+  std::vector<V3D> triangles;
+  triangles.reserve(3 * triMap.size());
+  for (const auto &triangle : triMap) {
+    for (const auto vertex : triangle)
+      triangles.emplace_back(pts[vertex - 1]);
   }
-  return sangle;
+  return triangles;
 }
 
 /**
- * Calculate the solid angle for a cylinder using triangulation EXCLUDING the
- * end caps.
- * @param observer :: The observer's point
+ * Get the solid angle of a cuboid defined by 4 points. Simple use of triangle
+ * based solid angle
+ * calculation. Should work for parallel-piped as well.
+ * @param observer :: point from which solid angle required
+ * @param vectors :: vector of V3D - the values are the 4 points used to defined
+ * the cuboid
+ * @return :: solid angle of cuboid - good accuracy
+ */
+double cuboidSolidAngle(const V3D &observer, const std::vector<V3D> &vectors) {
+  return positiveSolidAngle(cuboidSolidAngleTriangles(vectors), observer);
+}
+
+/**
+ * Get the triangles used for the solid angle of a cylinder EXCLUDING the end
+ * caps.
  * @param centre :: The centre vector
  * @param axis :: The axis vector
  * @param radius :: The radius
  * @param height :: The height
- * @returns The solid angle value
+ * @param numberOfSlices :: The number of slices around the axis
+ * @returns The vertices of the triangles, three per triangle
  */
-double cylinderSolidAngle(const V3D &observer, const V3D &centre, const V3D &axis, const double radius,
-                          const double height, const int numberOfSlices) {
+std::vector<V3D> cylinderSolidAngleTriangles(const V3D &centre, const V3D &axis, const double radius,
+                                             const double height, const int numberOfSlices) {
   // The cylinder is triangulated along its axis EXCLUDING the end caps so that
   // stacked cylinders give the correct value of solid angle (i.e shadowing is
-  // loosely taken into account by this method) Any triangle that has a normal
-  // facing away from the observer gives a negative solid angle and is excluded
+  // loosely taken into account by this method)
   // For simplicity the triangulation points are constructed such that the cone
   // axis points up the +Z axis and then rotated into their final position
 
@@ -318,7 +312,8 @@ double cylinderSolidAngle(const V3D &observer, const V3D &centre, const V3D &axi
 
   const double z_step = height / Cylinder::g_NSTACKS;
   double z0(0.0), z1(z_step);
-  double solid_angle(0.0);
+  std::vector<V3D> triangles;
+  triangles.reserve(6 * Cylinder::g_NSTACKS * numberOfSlices);
   for (int st = 1; st <= Cylinder::g_NSTACKS; ++st) {
     // cppcheck-suppress knownConditionTrueFalse as although Cylinder::g_NSTACKS is currently set at 1 if this changes
     // this code block is necessary
@@ -346,20 +341,28 @@ double cylinderSolidAngle(const V3D &observer, const V3D &centre, const V3D &axi
       pt3 += centre;
       pt4 += centre;
 
-      double sa = triangleSolidAngle(pt1, pt4, pt3, observer);
-      if (sa > 0.0) {
-        solid_angle += sa;
-      }
-      sa = triangleSolidAngle(pt1, pt2, pt4, observer);
-      if (sa > 0.0) {
-        solid_angle += sa;
-      }
+      triangles.insert(triangles.end(), {pt1, pt4, pt3, pt1, pt2, pt4});
     }
     z0 = z1;
     z1 += z_step;
   }
+  return triangles;
+}
 
-  return solid_angle;
+/**
+ * Calculate the solid angle for a cylinder using triangulation EXCLUDING the
+ * end caps.
+ * @param observer :: The observer's point
+ * @param centre :: The centre vector
+ * @param axis :: The axis vector
+ * @param radius :: The radius
+ * @param height :: The height
+ * @param numberOfSlices :: The number of slices around the axis
+ * @returns The solid angle value
+ */
+double cylinderSolidAngle(const V3D &observer, const V3D &centre, const V3D &axis, const double radius,
+                          const double height, const int numberOfSlices) {
+  return positiveSolidAngle(cylinderSolidAngleTriangles(centre, axis, radius, height, numberOfSlices), observer);
 }
 
 /**
@@ -416,6 +419,7 @@ CSGObject::CSGObject(const CSGObject &A) : CSGObject() { *this = A; }
  */
 CSGObject &CSGObject::operator=(const CSGObject &A) {
   if (this != &A) {
+    m_compiledRule.reset();
     m_topRule = (A.m_topRule) ? A.m_topRule->clone() : nullptr;
     if (m_topRule) {
       m_topRule->setParent(nullptr); // Top rule has no parent
@@ -740,11 +744,28 @@ int CSGObject::checkSurfaceValid(const Kernel::V3D &point, const Kernel::V3D &di
  * @returns 1 if true and 0 if false
  */
 bool CSGObject::isValid(const Kernel::V3D &point) const {
+  if (m_compiledRule)
+    return m_compiledRule->isValid(point);
   if (!m_topRule)
     return false;
   return m_topRule->isValid(point);
 }
 
+/**
+ * Determines whether each of many points is inside the object. This is
+ * faster than testing the points one by one.
+ * @param points :: the points to test
+ * @returns a flag for each point, true if it is inside or on the surface
+ */
+std::vector<bool> CSGObject::isValid(const std::vector<Kernel::V3D> &points) const {
+  if (m_compiledRule)
+    return m_compiledRule->isValid(points);
+  std::vector<bool> valid(points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+    valid[i] = isValid(points[i]);
+  return valid;
+}
+
 /**
  * Determines is group of surface maps are valid
  * @param SMap :: map of SurfaceNumber : status
@@ -764,6 +785,7 @@ bool CSGObject::isValid(const std::map<int, int> &SMap) const {
  */
 int CSGObject::createSurfaceList(const int outFlag) {
   m_surList.clear();
+  m_compiledRule = std::make_unique<CompiledRule>(*m_topRule);
   std::stack<const Rule *> TreeLine;
   TreeLine.push(m_topRule.get());
   while (!TreeLine.empty()) {
@@ -893,8 +915,13 @@ void CSGObject::print() const {
  * Takes the complement of a group
  */
 void CSGObject::makeComplement() {
+  // Only a rule tree whose surfaces have been populated can be compiled
+  const bool compiled = m_compiledRule != nullptr;
+  m_compiledRule.reset();
   std::unique_ptr<Rule> NCG = procComp(std::move(m_topRule));
   m_topRule = std::move(NCG);
+  if (compiled)
+    m_compiledRule = std::make_unique<CompiledRule>(*m_topRule);
 }
 
 /**
@@ -949,6 +976,7 @@ void CSGObject::write(std::ostream &outStream) const {
  * @param lineStr :: String value
  */
 void CSGObject::procString(const std::string &lineStr) {
+  m_compiledRule.reset();
   m_topRule = nullptr;
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0;                                  // Current index (not necessary size of RuleList
@@ -1187,6 +1215,36 @@ double CSGObject::solidAngle(const SolidAngleParams &params, const Kernel::V3D &
   return triangulatedSolidAngle(params, scaleFactor);
 }
 
+/**
+ * Get the triangles that triangulatedSolidAngle sums for a cuboid or a
+ * cylinder. Detectors usually share a few shapes so callers evaluating the
+ * solid angle of many detectors can build the triangles once per shape and
+ * sum the triangles facing each observer, which they have put into the frame
+ * of the shape. This is only valid for observers outside the bounding box and
+ * without scaling.
+ * @param numberOfCylinderSlices :: the number of slices around a cylinder
+ * @return the vertices of the triangles, three per triangle, or an empty list
+ * if the solid angle of this shape is not calculated from a fixed set of
+ * triangles
+ */
+std::vector<Kernel::V3D> CSGObject::solidAngleTriangles(const int numberOfCylinderSlices) const {
+  if (this->numberOfTriangles() > 30000)
+    return {};
+  double height(0.0), radius(0.0), innerRadius(0.0);
+  detail::ShapeInfo::GeometryShape type;
+  std::vector<Kernel::V3D> geometry_vectors;
+  this->GetObjectGeom(type, geometry_vectors, innerRadius, radius, height);
+  switch (type) {
+  case detail::ShapeInfo::GeometryShape::CUBOID:
+    return cuboidSolidAngleTriangles(geometry_vectors);
+  case detail::ShapeInfo::GeometryShape::CYLINDER:
+    return cylinderSolidAngleTriangles(geometry_vectors[0], geometry_vectors[1], radius, height,
+                                       numberOfCylinderSlices);
+  default:
+    return {};
+  }
+}
+
 /**
  * Given an observer position find the approximate solid angle of the object
  * @param observer :: position of the observer (V3D)
@@ -1587,16 +1645,24 @@ double CSGObject::singleShotMonteCarloVolume(const int shotSize, const size_t se
     rnEngine.discard(currentThreadNum * 3 * blocksize);
     std::uniform_real_distribution<double> rnDistribution(0.0, 1.0);
     int hits = 0;
-    for (int i = 0; i < static_cast<int>(blocksize); ++i) {
-      double rnd = rnDistribution(rnEngine);
-      const double x = boundingBox.xMin() + rnd * boundingDx;
-      rnd = rnDistribution(rnEngine);
-      const double y = boundingBox.yMin() + rnd * boundingDy;
-      rnd = rnDistribution(rnEngine);
-      const double z = boundingBox.zMin() + rnd * boundingDz;
-      if (isValid(V3D(x, y, z))) {
-        ++hits;
+    // Points are tested in batches, drawing the random numbers in the same
+    // order as one at a time would
+    constexpr size_t batchSize = 1024;
+    std::vector<V3D> points;
+    points.reserve(std::min(batchSize, blocksize));
+    for (size_t batchStart = 0; batchStart < blocksize; batchStart += batchSize) {
+      points.clear();
+      for (size_t i = batchStart; i < std::min(batchStart + batchSize, blocksize); ++i) {
+        double rnd = rnDistribution(rnEngine);
+        const double x = boundingBox.xMin() + rnd * boundingDx;
+        rnd = rnDistribution(rnEngine);
+        const double y = boundingBox.yMin() + rnd * boundingDy;
+        rnd = rnDistribution(rnEngine);
+        const double z = boundingBox.zMin() + rnd * boundingDz;
+        points.emplace_back(x, y, z);
       }
+      const auto valid = isValid(points);
+      hits += static_cast<int>(std::count(valid.cbegin(), valid.cend(), true));
     }
     // Collect results.
     PARALLEL_ATOMIC
@@ -0,0 +1,236 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/CompiledRule.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Surfaces/Plane.h"
+#include "MantidGeometry/Surfaces/Sphere.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <cmath>
+#include <typeinfo>
+
+namespace Mantid::Geometry {
+using Kernel::Tolerance;
+using Kernel::V3D;
+
+namespace {
+/// The side of a plane as in Plane::side
+inline int planeSide(const double displacement) {
+  if (Tolerance < std::abs(displacement))
+    return (displacement > 0) ? 1 : -1;
+  return 0;
+}
+
+/// The side of a sphere as in Sphere::side
+inline int sphereSide(const double displacement) {
+  if (std::fabs(displacement) < Tolerance)
+    return 0;
+  return (displacement > 0.0) ? 1 : -1;
+}
+} // namespace
+
+/**
+ * Evaluate the subtree starting at a node.
+ * @param node :: the index of the node
+ * @param point :: the point to test
+ * @param sideOf :: returns the side of the point for a surface index
+ * @return true if the point satisfies the subtree
+ */
+template <typename SideFunction>
+bool CompiledRule::evaluate(const size_t node, const V3D &point, const SideFunction &sideOf) const {
+  const auto &current = m_nodes[node];
+  switch (current.operation) {
+  case Operation::Intersection:
+    return evaluate(node + 1, point, sideOf) && evaluate(m_nodes[node + 1].end, point, sideOf);
+  case Operation::Union:
+    return evaluate(node + 1, point, sideOf) || evaluate(m_nodes[node + 1].end, point, sideOf);
+  case Operation::Complement:
+    return !evaluate(node + 1, point, sideOf);
+  case Operation::Surface:
+    return sideOf(current.item) * current.sign >= 0;
+  case Operation::Rule:
+    return m_rules[current.item]->isValid(point);
+  case Operation::True:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/**
+ * Compile a rule tree.
+ * @param rule :: the top rule of the tree, which must outlive this object
+ */
+CompiledRule::CompiledRule(const Rule &rule) { compile(rule); }
+
+/**
+ * Classify a point.
+ * @param point :: the point to test
+ * @return true if the point is inside or on the surface of the object
+ */
+bool CompiledRule::isValid(const V3D &point) const {
+  return evaluate(0, point, [this, &point](const size_t surface) { return side(surface, point); });
+}
+
+/**
+ * Classify many points. The sides of the planes and spheres are computed for
+ * all points in tight loops before the rules are evaluated, which is faster
+ * than classifying the points one by one.
+ * @param points :: the points to test
+ * @return a flag for each point, true if it is inside or on the surface
+ */
+std::vector<bool> CompiledRule::isValid(const std::vector<V3D> &points) const {
+  const auto numberOfPoints = points.size();
+  std::vector<double> x(numberOfPoints), y(numberOfPoints), z(numberOfPoints);
+  for (size_t i = 0; i < numberOfPoints; ++i) {
+    x[i] = points[i].X();
+    y[i] = points[i].Y();
+    z[i] = points[i].Z();
+  }
+  std::vector<int8_t> sides(m_surfaces.size() * numberOfPoints);
+  for (size_t surface = 0; surface < m_surfaces.size(); ++surface) {
+    auto *surfaceSides = sides.data() + surface * numberOfPoints;
+    const auto j = m_surfaces[surface].index;
+    switch (m_surfaces[surface].type) {
+    case SurfaceType::Plane: {
+      const double nx = m_planeNormalX[j], ny = m_planeNormalY[j], nz = m_planeNormalZ[j], d = m_planeDistance[j];
+      for (size_t i = 0; i < numberOfPoints; ++i)
+        surfaceSides[i] = static_cast<int8_t>(planeSide(nx * x[i] + ny * y[i] + nz * z[i] - d));
+      break;
+    }
+    case SurfaceType::Sphere: {
+      const double cx = m_sphereCentreX[j], cy = m_sphereCentreY[j], cz = m_sphereCentreZ[j], r = m_sphereRadius[j];
+      for (size_t i = 0; i < numberOfPoints; ++i) {
+        const double xdiff(x[i] - cx), ydiff(y[i] - cy), zdiff(z[i] - cz);
+        surfaceSides[i] = static_cast<int8_t>(sphereSide(std::sqrt(xdiff * xdiff + ydiff * ydiff + zdiff * zdiff) - r));
+      }
+      break;
+    }
+    default:
+      for (size_t i = 0; i < numberOfPoints; ++i)
+        surfaceSides[i] = static_cast<int8_t>(m_surfaces[surface].surface->side(points[i]));
+    }
+  }
+
+  std::vector<bool> valid(numberOfPoints);
+  for (size_t i = 0; i < numberOfPoints; ++i) {
+    valid[i] = evaluate(0, points[i], [&sides, i, numberOfPoints](const size_t surface) {
+      return static_cast<int>(sides[surface * numberOfPoints + i]);
+    });
+  }
+  return valid;
+}
+
+/**
+ * Append the nodes of a rule and its subtree in pre-order. The structure
+ * mirrors the isValid methods of the Rule classes, including their handling
+ * of missing leaves.
+ * @param rule :: the rule to append
+ */
+void CompiledRule::compile(const Rule &rule) {
+  const auto index = m_nodes.size();
+  m_nodes.emplace_back(Node{Operation::False, 1, 0, 0});
+  Operation operation = Operation::False;
+  if (dynamic_cast<const Intersection *>(&rule)) {
+    if (rule.leaf(0) && rule.leaf(1)) {
+      operation = Operation::Intersection;
+      compile(*rule.leaf(0));
+      compile(*rule.leaf(1));
+    }
+  } else if (dynamic_cast<const Union *>(&rule)) {
+    const auto *first = rule.leaf(0);
+    const auto *second = rule.leaf(1);
+    if (first && second) {
+      operation = Operation::Union;
+      compile(*first);
+      compile(*second);
+    } else if (first || second) {
+      // A union with a single operand is that operand
+      m_nodes.pop_back();
+      compile(first ? *first : *second);
+      return;
+    }
+  } else if (const auto *surfPoint = dynamic_cast<const SurfPoint *>(&rule)) {
+    if (surfPoint->getKey()) {
+      operation = Operation::Surface;
+      const auto sign = surfPoint->getSign();
+      m_nodes[index].sign = static_cast<int8_t>((sign > 0) - (sign < 0));
+      m_nodes[index].item = addSurface(*surfPoint->getKey());
+    }
+  } else if (dynamic_cast<const CompGrp *>(&rule)) {
+    if (rule.leaf(0)) {
+      operation = Operation::Complement;
+      compile(*rule.leaf(0));
+    } else {
+      operation = Operation::True;
+    }
+  } else {
+    // Complements of other objects and fixed values use their own classes
+    operation = Operation::Rule;
+    m_nodes[index].item = static_cast<uint32_t>(m_rules.size());
+    m_rules.emplace_back(&rule);
+  }
+  m_nodes[index].operation = operation;
+  m_nodes[index].end = static_cast<uint32_t>(m_nodes.size());
+}
+
+/**
+ * Store a surface, once however often the rules refer to it.
+ * @param surface :: the surface of a SurfPoint
+ * @return the index of the surface
+ */
+uint32_t CompiledRule::addSurface(const Surface &surface) {
+  for (size_t i = 0; i < m_surfaces.size(); ++i) {
+    if (m_surfaces[i].surface == &surface)
+      return static_cast<uint32_t>(i);
+  }
+  // Only exact types are evaluated inline so that overridden side methods
+  // are respected
+  if (typeid(surface) == typeid(Plane)) {
+    const auto &plane = static_cast<const Plane &>(surface);
+    m_surfaces.emplace_back(SurfaceRef{&surface, SurfaceType::Plane, static_cast<uint32_t>(m_planeDistance.size())});
+    m_planeNormalX.emplace_back(plane.getNormal().X());
+    m_planeNormalY.emplace_back(plane.getNormal().Y());
+    m_planeNormalZ.emplace_back(plane.getNormal().Z());
+    m_planeDistance.emplace_back(plane.getDistance());
+  } else if (typeid(surface) == typeid(Sphere)) {
+    const auto &sphere = static_cast<const Sphere &>(surface);
+    m_surfaces.emplace_back(SurfaceRef{&surface, SurfaceType::Sphere, static_cast<uint32_t>(m_sphereRadius.size())});
+    const auto centre = sphere.getCentre();
+    m_sphereCentreX.emplace_back(centre.X());
+    m_sphereCentreY.emplace_back(centre.Y());
+    m_sphereCentreZ.emplace_back(centre.Z());
+    m_sphereRadius.emplace_back(sphere.getRadius());
+  } else {
+    m_surfaces.emplace_back(SurfaceRef{&surface, SurfaceType::Other, 0});
+  }
+  return static_cast<uint32_t>(m_surfaces.size() - 1);
+}
+
+/**
+ * Find which side of a surface a point is on, as Surface::side does.
+ * @param surface :: the index of the surface
+ * @param point :: the point to test
+ * @return 1 on the positive side, -1 on the negative side, 0 on the surface
+ */
+int CompiledRule::side(const size_t surface, const V3D &point) const {
+  const auto j = m_surfaces[surface].index;
+  switch (m_surfaces[surface].type) {
+  case SurfaceType::Plane:
+    return planeSide(m_planeNormalX[j] * point.X() + m_planeNormalY[j] * point.Y() + m_planeNormalZ[j] * point.Z() -
+                     m_planeDistance[j]);
+  case SurfaceType::Sphere: {
+    const double xdiff(point.X() - m_sphereCentreX[j]), ydiff(point.Y() - m_sphereCentreY[j]),
+        zdiff(point.Z() - m_sphereCentreZ[j]);
+    return sphereSide(std::sqrt(xdiff * xdiff + ydiff * ydiff + zdiff * zdiff) - m_sphereRadius[j]);
+  }
+  default:
+    return m_surfaces[surface].surface->side(point);
+  }
+}
+
+} // namespace Mantid::Geometry
@@ -9,9 +9,13 @@
 //-------------------------------------------------------------
 #include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidGeometry/IComponent.h"
+#include "MantidGeometry/IObjComponent.h"
+#include "MantidGeometry/Instrument/CompAssembly.h"
+#include "MantidGeometry/Instrument/GridDetector.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/V3D.h"
+#include <algorithm>
 #include <deque>
 #include <iterator>
 #include <utility>
@@ -20,6 +24,11 @@ namespace Mantid::Geometry {
 
 using Kernel::V3D;
 
+namespace {
+/// Assemblies with fewer children than this test each child in turn
+constexpr int MIN_CHILDREN_FOR_HIERARCHY = 8;
+} // namespace
+
 //-------------------------------------------------------------
 // Public member functions
 //-------------------------------------------------------------
@@ -129,31 +138,95 @@ void InstrumentRayTracer::fireRay(Track &testRay) const {
   // Start at the root of the tree
   nodeQueue.emplace_back(m_instrument);
 
+  std::vector<size_t> hits;
   IComponent_const_sptr node;
   while (!nodeQueue.empty()) {
     node = nodeQueue.front();
     nodeQueue.pop_front();
-    BoundingBox bbox;
-    auto it = m_boxCache.find(node->getComponentID());
-    if (it != m_boxCache.end()) {
-      bbox = it->second;
-    } else {
-      node->getBoundingBox(bbox);
-      std::lock_guard<std::mutex> lock(m_mutex);
-      m_boxCache[node->getComponentID()] = bbox;
-    }
 
     // Quick test. If this suceeds moved on to test the children
-    if (bbox.doesLineIntersect(testRay)) {
-      if (ICompAssembly_const_sptr assembly = std::dynamic_pointer_cast<const ICompAssembly>(node)) {
-        assembly->testIntersectionWithChildren(testRay, nodeQueue);
-      } else {
-        throw Kernel::Exception::NotImplementedError("Implement non-comp assembly interactions");
+    if (!boundingBox(*node).doesLineIntersect(testRay))
+      continue;
+    auto assembly = std::dynamic_pointer_cast<const ICompAssembly>(node);
+    if (!assembly)
+      throw Kernel::Exception::NotImplementedError("Implement non-comp assembly interactions");
+    const auto hierarchy = childHierarchy(*assembly);
+    if (!hierarchy) {
+      assembly->testIntersectionWithChildren(testRay, nodeQueue);
+      continue;
+    }
+    // Only the children whose bounding box is hit need a closer look
+    hits.clear();
+    hierarchy->intersectingBoxes(testRay.startPoint(), testRay.direction(), hits);
+    std::sort(hits.begin(), hits.end());
+    for (const auto index : hits) {
+      auto child = assembly->getChild(static_cast<int>(index));
+      if (std::dynamic_pointer_cast<ICompAssembly>(child)) {
+        nodeQueue.emplace_back(std::move(child));
+      } else if (auto const *physicalObject = dynamic_cast<IObjComponent *>(child.get())) {
+        physicalObject->interceptSurface(testRay);
       }
     }
   }
 }
 
+/**
+ * Find the bounding box of a component, caching it for later rays.
+ * @param component :: The component
+ * @return The bounding box of the component
+ */
+BoundingBox InstrumentRayTracer::boundingBox(const IComponent &component) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_boxCache.find(component.getComponentID());
+  if (it != m_boxCache.end())
+    return it->second;
+  BoundingBox bbox;
+  component.getBoundingBox(bbox);
+  m_boxCache[component.getComponentID()] = bbox;
+  return bbox;
+}
+
+/**
+ * Find the hierarchy of the bounding boxes of the children of an assembly.
+ * It is built the first time a ray reaches the assembly, so that assemblies
+ * no ray passes near cost nothing, and is reused for every later ray. The
+ * bounding boxes of child assemblies are cached on the way.
+ * @param assembly :: The assembly
+ * @return The hierarchy, or nullptr if the children of the assembly should be
+ * tested by the assembly itself
+ */
+std::shared_ptr<const BoundingVolumeHierarchy>
+InstrumentRayTracer::childHierarchy(const ICompAssembly &assembly) const {
+  // Grid detectors find the pixel that is hit directly
+  if (!dynamic_cast<const CompAssembly *>(&assembly) || dynamic_cast<const GridDetector *>(&assembly))
+    return nullptr;
+  const int nchildren = assembly.nelements();
+  if (nchildren < MIN_CHILDREN_FOR_HIERARCHY)
+    return nullptr;
+
+  const auto id = assembly.getComponentID();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_hierarchyCache.find(id);
+    if (it != m_hierarchyCache.end())
+      return it->second;
+  }
+  std::vector<BoundingBox> boxes(nchildren);
+  std::vector<std::pair<ComponentID, size_t>> assemblies;
+  for (int i = 0; i < nchildren; ++i) {
+    const auto child = assembly.getChild(i);
+    child->getBoundingBox(boxes[i]);
+    if (std::dynamic_pointer_cast<ICompAssembly>(child))
+      assemblies.emplace_back(child->getComponentID(), i);
+  }
+  auto hierarchy = std::make_shared<const BoundingVolumeHierarchy>(boxes);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const auto &[childID, index] : assemblies)
+    m_boxCache.emplace(childID, boxes[index]);
+  m_hierarchyCache.emplace(id, hierarchy);
+  return hierarchy;
+}
+
 ///**
 // * Perform a quick check as to whether the ray passes through the component
 // * @param component :: The test component
@@ -41,6 +41,32 @@ void MeshObject::initialize() {
 
   MeshObjectCommon::checkVertexLimit(m_vertices.size());
   m_handler = std::make_shared<GeometryHandler>(*this);
+  verticesChanged();
+}
+
+/**
+ * Reset the bounding box and rebuild the hierarchy of triangle bounding boxes
+ * after the vertices have been set or moved.
+ */
+void MeshObject::verticesChanged() {
+  m_boundingBox = BoundingBox();
+  std::vector<BoundingBox> triangleBoxes;
+  triangleBoxes.reserve(numberOfTriangles());
+  Kernel::V3D vertex1, vertex2, vertex3;
+  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+    Kernel::V3D minPoint(vertex1), maxPoint(vertex1);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      minPoint[axis] = std::min({vertex1[axis], vertex2[axis], vertex3[axis]});
+      maxPoint[axis] = std::max({vertex1[axis], vertex2[axis], vertex3[axis]});
+    }
+    // rayIntersectsTriangle accepts intersections slightly behind the start
+    // of a ray, within a distance that grows with the size of the triangle
+    const auto padding = 1e-7 * maxPoint.distance(minPoint);
+    minPoint -= Kernel::V3D(padding, padding, padding);
+    maxPoint += Kernel::V3D(padding, padding, padding);
+    triangleBoxes.emplace_back(maxPoint.X(), maxPoint.Y(), maxPoint.Z(), minPoint.X(), minPoint.Y(), minPoint.Z());
+  }
+  m_triangleHierarchy = BoundingVolumeHierarchy(triangleBoxes);
 }
 
 /**
@@ -70,15 +96,45 @@ bool MeshObject::hasValidShape() const {
  * @returns true if point is within object or on surface
  */
 bool MeshObject::isValid(const Kernel::V3D &point) const {
+  std::vector<Kernel::V3D> intersectionPoints;
+  std::vector<TrackDirection> entryExitFlags;
+  return isValid(point, intersectionPoints, entryExitFlags);
+}
 
-  BoundingBox bb = getBoundingBox();
+/**
+ * Determines which points are within the object or on the surface
+ * @param points :: Points to be tested
+ * @returns a flag for each point, true if it is within object or on surface
+ */
+std::vector<bool> MeshObject::isValid(const std::vector<Kernel::V3D> &points) const {
+  std::vector<bool> valid(points.size());
+  std::vector<Kernel::V3D> intersectionPoints;
+  std::vector<TrackDirection> entryExitFlags;
+  for (size_t i = 0; i < points.size(); ++i) {
+    valid[i] = isValid(points[i], intersectionPoints, entryExitFlags);
+  }
+  return valid;
+}
+
+/**
+ * Determines whether point is within the object or on the surface
+ * @param point :: Point to be tested
+ * @param intersectionPoints :: Work space for the intersections, reused
+ * between calls
+ * @param entryExitFlags :: Work space for the entry-exit flags, reused between
+ * calls
+ * @returns true if point is within object or on surface
+ */
+bool MeshObject::isValid(const Kernel::V3D &point, std::vector<Kernel::V3D> &intersectionPoints,
+                         std::vector<TrackDirection> &entryExitFlags) const {
+  const BoundingBox &bb = getBoundingBox();
   if (!bb.isPointInside(point)) {
     return false;
   }
 
   Kernel::V3D direction(0.0, 0.0, 1.0); // direction to look for intersections
-  std::vector<Kernel::V3D> intersectionPoints;
-  std::vector<TrackDirection> entryExitFlags;
+  intersectionPoints.clear();
+  entryExitFlags.clear();
 
   getIntersections(point, direction, intersectionPoints, entryExitFlags);
 
@@ -177,7 +233,8 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
 double MeshObject::distance(const Track &track) const {
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection unused;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  for (const auto i : candidateTriangles(track.startPoint(), track.direction())) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(track.startPoint(), track.direction(), vertex1, vertex2, vertex3,
                                                 intersection, unused)) {
       return track.startPoint().distance(intersection);
@@ -202,7 +259,8 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
 
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  for (const auto i : candidateTriangles(start, direction)) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1, vertex2, vertex3, intersection, entryExit)) {
       intersectionPoints.emplace_back(intersection);
       entryExitFlags.emplace_back(entryExit);
@@ -211,6 +269,21 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
   // still need to deal with edge cases
 }
 
+/**
+ * Get the triangles whose bounding boxes a ray passes through. They are
+ * returned in increasing order so that the triangles are tested in the same
+ * order as when every triangle is tested.
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @returns the indices of the triangles
+ */
+std::vector<size_t> MeshObject::candidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction) const {
+  std::vector<size_t> triangles;
+  m_triangleHierarchy.intersectingBoxes(start, direction, triangles);
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
 /*
  * Get a triangle - useful for iterating over triangles
  * @param index :: Index of triangle in MeshObject
@@ -272,10 +345,22 @@ void MeshObject::getBoundingBox(double &xmax, double &ymax, double &zmax, double
  * @return :: estimate of solid angle of object.
  */
 double MeshObject::solidAngle(const SolidAngleParams &params) const {
+  return solidAngle(params, Kernel::V3D(1.0, 1.0, 1.0));
+}
+
+/**
+ * Find solid angle of object wrt the observer with a scaleFactor for the
+ * object.
+ * @param params :: point to measure solid angle from, and number of cylinder slices
+ * @param scaleFactor :: Kernel::V3D giving scaling of the object
+ * @return :: estimate of solid angle of object.
+ */
+double MeshObject::solidAngle(const SolidAngleParams &params, const Kernel::V3D &scaleFactor) const {
   double solidAngleSum(0), solidAngleNegativeSum(0);
   Kernel::V3D vertex1, vertex2, vertex3;
   for (size_t i = 0; this->getTriangle(i, vertex1, vertex2, vertex3); ++i) {
-    double sa = MeshObjectCommon::getTriangleSolidAngle(vertex1, vertex2, vertex3, params.observer());
+    double sa = MeshObjectCommon::getTriangleSolidAngle(scaleFactor * vertex1, scaleFactor * vertex2,
+                                                        scaleFactor * vertex3, params.observer());
     if (sa > 0.0) {
       solidAngleSum += sa;
     } else {
@@ -292,22 +377,6 @@ double MeshObject::solidAngle(const SolidAngleParams &params) const {
   return 0.5 * (solidAngleSum - solidAngleNegativeSum);
 }
 
-/**
- * Find solid angle of object wrt the observer with a scaleFactor for the
- * object.
- * @param params :: point to measure solid angle from, and number of cylinder slices
- * @param scaleFactor :: Kernel::V3D giving scaling of the object
- * @return :: estimate of solid angle of object.
- */
-double MeshObject::solidAngle(const SolidAngleParams &params, const Kernel::V3D &scaleFactor) const {
-  std::vector<Kernel::V3D> scaledVertices;
-  scaledVertices.reserve(m_vertices.size());
-  std::transform(m_vertices.cbegin(), m_vertices.cend(), std::back_inserter(scaledVertices),
-                 [&scaleFactor](const auto &vertex) { return scaleFactor * vertex; });
-  MeshObject meshScaled(m_triangles, scaledVertices, m_material);
-  return meshScaled.solidAngle(params);
-}
-
 /**
  * Calculate volume.
  * @return The volume.
@@ -477,6 +546,7 @@ std::shared_ptr<GeometryHandler> MeshObject::getGeometryHandler() const {
 void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   std::for_each(m_vertices.begin(), m_vertices.end(),
                 [&rotationMatrix](auto &vertex) { vertex.rotate(rotationMatrix); });
+  verticesChanged();
 }
 
 /**
@@ -486,6 +556,7 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&translationVector](const auto &vertex) { return vertex + translationVector; });
+  verticesChanged();
 }
 
 /**
@@ -495,6 +566,7 @@ void MeshObject::translate(const Kernel::V3D &translationVector) {
 void MeshObject::scale(const double scaleFactor) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&scaleFactor](const auto &vertex) { return vertex * scaleFactor; });
+  verticesChanged();
 }
 
 /**
@@ -520,6 +592,7 @@ void MeshObject::multiply(const Kernel::Matrix<double> &matrix) {
     Kernel::V3D newvertex(vertexout[0], vertexout[1], vertexout[2]);
     vertex = newvertex;
   }
+  verticesChanged();
 }
 
 /**
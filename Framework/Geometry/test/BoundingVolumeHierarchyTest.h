@@ -0,0 +1,98 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+
+using Mantid::Geometry::BoundingBox;
+using Mantid::Geometry::BoundingVolumeHierarchy;
+using Mantid::Kernel::V3D;
+
+class BoundingVolumeHierarchyTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BoundingVolumeHierarchyTest *createSuite() { return new BoundingVolumeHierarchyTest(); }
+  static void destroySuite(BoundingVolumeHierarchyTest *suite) { delete suite; }
+
+  void test_empty_hierarchy_finds_nothing() {
+    BoundingVolumeHierarchy hierarchy(std::vector<BoundingBox>{});
+    TS_ASSERT_EQUALS(hierarchy.size(), 0);
+    TS_ASSERT(intersecting(hierarchy, V3D(), V3D(0, 0, 1)).empty());
+  }
+
+  void test_ray_along_a_row_finds_the_boxes_of_that_row() {
+    const auto hierarchy = BoundingVolumeHierarchy(grid());
+    TS_ASSERT_EQUALS(hierarchy.size(), 100);
+    // a ray along x through the centre of row y = 3
+    const auto hits = intersecting(hierarchy, V3D(-5, 3.5, 0.5), V3D(1, 0, 0));
+    std::vector<size_t> expected;
+    for (size_t x = 0; x < 10; ++x)
+      expected.emplace_back(3 * 10 + x);
+    TS_ASSERT_EQUALS(hits, expected);
+  }
+
+  void test_ray_only_finds_boxes_ahead_of_its_start() {
+    const auto hierarchy = BoundingVolumeHierarchy(grid());
+    const auto hits = intersecting(hierarchy, V3D(7.5, 2.5, 0.5), V3D(-1, 0, 0));
+    TS_ASSERT_EQUALS(hits, std::vector<size_t>({20, 21, 22, 23, 24, 25, 26, 27}));
+  }
+
+  void test_diagonal_ray_finds_the_boxes_it_crosses() {
+    const auto boxes = grid();
+    const auto hierarchy = BoundingVolumeHierarchy(boxes);
+    const V3D start(-1, -0.5, 0.5);
+    const V3D direction = normalize(V3D(1, 0.75, 0));
+    // compare with testing every box
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      if (boxes[i].doesLineIntersect(start, direction))
+        expected.emplace_back(i);
+    }
+    TS_ASSERT(!expected.empty());
+    TS_ASSERT_EQUALS(intersecting(hierarchy, start, direction), expected);
+  }
+
+  void test_ray_missing_every_box_finds_nothing() {
+    const auto hierarchy = BoundingVolumeHierarchy(grid());
+    TS_ASSERT(intersecting(hierarchy, V3D(-5, 3.5, 2), V3D(1, 0, 0)).empty());
+    TS_ASSERT(intersecting(hierarchy, V3D(-5, 3.5, 0.5), V3D(-1, 0, 0)).empty());
+  }
+
+  void test_null_boxes_are_always_found() {
+    auto boxes = grid();
+    boxes.emplace_back();
+    const auto hierarchy = BoundingVolumeHierarchy(boxes);
+    TS_ASSERT_EQUALS(hierarchy.size(), 101);
+    TS_ASSERT_EQUALS(intersecting(hierarchy, V3D(-5, 3.5, 2), V3D(1, 0, 0)), std::vector<size_t>{100});
+  }
+
+private:
+  /// A 10 x 10 grid of unit boxes in the z = 0 plane, numbered along x first
+  std::vector<BoundingBox> grid() const {
+    std::vector<BoundingBox> boxes;
+    for (int y = 0; y < 10; ++y) {
+      for (int x = 0; x < 10; ++x) {
+        boxes.emplace_back(x + 0.9, y + 0.9, 1, x + 0.1, y + 0.1, 0);
+      }
+    }
+    return boxes;
+  }
+
+  std::vector<size_t> intersecting(const BoundingVolumeHierarchy &hierarchy, const V3D &start,
+                                   const V3D &direction) const {
+    std::vector<size_t> indices;
+    hierarchy.intersectingBoxes(start, direction, indices);
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  }
+};
@@ -10,6 +10,7 @@
 
 #include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
 #include "MantidGeometry/Math/Algebra.h"
+#include "MantidGeometry/Objects/MeshObjectCommon.h"
 #include "MantidGeometry/Objects/Rules.h"
 #include "MantidGeometry/Objects/ShapeFactory.h"
 #include "MantidGeometry/Objects/Track.h"
@@ -1479,6 +1480,33 @@ public:
                     2 * M_PI, satol);
   }
 
+  void testSolidAngleTrianglesGiveTheTriangulatedSolidAngle() {
+    std::shared_ptr<CSGObject> cylinder = createSmallCappedCylinder();
+    auto h = std::make_shared<GeometryHandler>(cylinder);
+    detail::ShapeInfo shapeInfo;
+    shapeInfo.setCylinder(V3D(-0.0015, 0.0, 0.0), V3D(1., 0.0, 0.0), 0.005, 0.003);
+    h->setShapeInfo(std::move(shapeInfo));
+    cylinder->setGeometryHandler(h);
+    const auto cylinderTriangles = cylinder->solidAngleTriangles(11);
+    TS_ASSERT_EQUALS(cylinderTriangles.size(), 6 * 11);
+    for (const auto &observer : {V3D(0, 0, 0.1), V3D(0.1, 0.0, 0.1), V3D(-0.5, 0.0, 0.0)}) {
+      TS_ASSERT_EQUALS(sumOfPositiveSolidAngles(cylinderTriangles, observer),
+                       cylinder->triangulatedSolidAngle(SolidAngleParams(observer, 11)));
+    }
+
+    auto cube = ComponentCreationHelper::createCuboid(0.5);
+    const auto cubeTriangles = cube->solidAngleTriangles(11);
+    TS_ASSERT_EQUALS(cubeTriangles.size(), 3 * 12);
+    for (const auto &observer : {V3D(0, 0, 1.0), V3D(1.0, 1.0, 1.0), V3D(2.0, -1.0, 3.0)}) {
+      TS_ASSERT_EQUALS(sumOfPositiveSolidAngles(cubeTriangles, observer),
+                       cube->triangulatedSolidAngle(SolidAngleParams(observer, 11)));
+    }
+  }
+
+  void testSolidAngleTrianglesAreEmptyForOtherShapes() {
+    TS_ASSERT(ComponentCreationHelper::createSphere(0.1)->solidAngleTriangles(10).empty());
+  }
+
   void testSolidAngleCubeTriangles()
   /**
   Test solid angle calculation for a cube using triangles
@@ -1896,6 +1924,17 @@ private:
     return;
   }
 
+  double sumOfPositiveSolidAngles(const std::vector<V3D> &triangles, const V3D &observer) {
+    double solidAngle = 0.0;
+    for (size_t i = 0; i < triangles.size(); i += 3) {
+      const double sa =
+          MeshObjectCommon::getTriangleSolidAngle(triangles[i], triangles[i + 1], triangles[i + 2], observer);
+      if (sa > 0.0)
+        solidAngle += sa;
+    }
+    return solidAngle;
+  }
+
   std::shared_ptr<CSGObject> createUnitCube() {
     std::string C1 = "px -0.5"; // cube +/-0.5
     std::string C2 = "px 0.5";
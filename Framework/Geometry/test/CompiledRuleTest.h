@@ -0,0 +1,112 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/Objects/CompiledRule.h"
+
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Surfaces/Cylinder.h"
+#include "MantidGeometry/Surfaces/Plane.h"
+#include "MantidGeometry/Surfaces/Sphere.h"
+#include "MantidKernel/MersenneTwister.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class CompiledRuleTest : public CxxTest::TestSuite {
+public:
+  void test_capped_cylinder_matches_rule_tree() { checkMatchesRuleTree(createObject("-31 -32 33")); }
+
+  void test_union_and_complement_match_rule_tree() {
+    checkMatchesRuleTree(createObject("(-41 : -42) #(-43 34)"));
+    checkMatchesRuleTree(createObject("#(-41 : 31) 32"));
+  }
+
+  void test_points_on_surfaces_are_valid() {
+    const auto object = createObject("-41");
+    const CompiledRule compiled(*object->topRule());
+    const std::vector<V3D> points{V3D(1, 0, 0), V3D(0, -1, 0), V3D(0, 0, 1.0001), V3D(0, 0, 0)};
+    const auto valid = compiled.isValid(points);
+    TS_ASSERT(valid[0]);
+    TS_ASSERT(valid[1]);
+    TS_ASSERT(!valid[2]);
+    TS_ASSERT(valid[3]);
+    for (size_t i = 0; i < points.size(); ++i)
+      TS_ASSERT_EQUALS(compiled.isValid(points[i]), valid[i]);
+  }
+
+  void test_object_uses_compiled_rule_after_changes() {
+    auto object = createObject("-41");
+    TS_ASSERT(object->compiledRule());
+    TS_ASSERT(!object->isValid(V3D(1.2, 0, 0)));
+    object->makeComplement();
+    TS_ASSERT(object->compiledRule());
+    TS_ASSERT(object->isValid(V3D(1.2, 0, 0)));
+    TS_ASSERT(!object->isValid(std::vector<V3D>{V3D(0.5, 0, 0)})[0]);
+    checkMatchesRuleTree(object);
+  }
+
+  void test_complement_of_unpopulated_object_is_not_compiled() {
+    CSGObject object;
+    object.setObject(21, "-41");
+    object.makeComplement();
+    TS_ASSERT(!object.compiledRule());
+    TS_ASSERT(object.topRule());
+  }
+
+private:
+  std::shared_ptr<CSGObject> createObject(const std::string &rule) {
+    std::map<int, std::shared_ptr<Surface>> surfaces;
+    surfaces[31] = std::make_shared<Cylinder>();
+    surfaces[31]->setSurface("cx 0.6");
+    surfaces[32] = std::make_shared<Plane>();
+    surfaces[32]->setSurface("px 1.2");
+    surfaces[33] = std::make_shared<Plane>();
+    surfaces[33]->setSurface("px -1.2");
+    surfaces[34] = std::make_shared<Plane>();
+    surfaces[34]->setSurface("py 0.1");
+    surfaces[41] = std::make_shared<Sphere>();
+    surfaces[41]->setSurface("so 1.0");
+    surfaces[42] = std::make_shared<Sphere>();
+    surfaces[42]->setSurface("s 1.2 0.0 0.0 0.5");
+    surfaces[43] = std::make_shared<Sphere>();
+    surfaces[43]->setSurface("s 0.0 0.2 0.0 0.4");
+    for (auto &surface : surfaces)
+      surface.second->setName(surface.first);
+
+    auto object = std::make_shared<CSGObject>();
+    object->setObject(21, rule);
+    object->populate(surfaces);
+    return object;
+  }
+
+  void checkMatchesRuleTree(const std::shared_ptr<CSGObject> &object) {
+    const auto *topRule = object->topRule();
+    const CompiledRule compiled(*topRule);
+    Mantid::Kernel::MersenneTwister rng(12345, -2.0, 2.0);
+    std::vector<V3D> points(5000);
+    for (auto &point : points)
+      point = V3D(rng.nextValue(), rng.nextValue(), rng.nextValue());
+
+    const auto valid = compiled.isValid(points);
+    const auto objectValid = object->isValid(points);
+    size_t numberInside(0);
+    for (size_t i = 0; i < points.size(); ++i) {
+      const bool expected = topRule->isValid(points[i]);
+      TS_ASSERT_EQUALS(compiled.isValid(points[i]), expected);
+      TS_ASSERT_EQUALS(valid[i], expected);
+      TS_ASSERT_EQUALS(objectValid[i], expected);
+      numberInside += expected ? 1 : 0;
+    }
+    // Both sides of the surfaces must have been tested
+    TS_ASSERT_LESS_THAN(0, numberInside);
+    TS_ASSERT_LESS_THAN(numberInside, points.size());
+  }
+};
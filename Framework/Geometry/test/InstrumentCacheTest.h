@@ -0,0 +1,148 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/FitParameter.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MantidVersion.h"
+
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::ConfigService;
+
+class InstrumentCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentCacheTest *createSuite() { return new InstrumentCacheTest(); }
+  static void destroySuite(InstrumentCacheTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_path = (std::filesystem::temp_directory_path() / "InstrumentCacheTest.instrument").string();
+  }
+
+  void tearDown() override { std::filesystem::remove(m_path); }
+
+  void test_saved_instrument_is_rebuilt() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(2);
+    instrument->getParameterMap()->addDouble(instrument->getDetector(5).get(), "efficiency", 0.75);
+    TS_ASSERT(InstrumentCache::save(*instrument, m_path));
+
+    const auto loaded = InstrumentCache::load(m_path);
+    TS_ASSERT(loaded);
+    TS_ASSERT_EQUALS(loaded->getName(), instrument->getName());
+    TS_ASSERT_EQUALS(loaded->getDetectorIDs(), instrument->getDetectorIDs());
+    for (const auto id : instrument->getDetectorIDs()) {
+      TS_ASSERT_EQUALS(loaded->getDetector(id)->getPos(), instrument->getDetector(id)->getPos());
+      TS_ASSERT_EQUALS(loaded->getDetector(id)->getFullName(), instrument->getDetector(id)->getFullName());
+    }
+    TS_ASSERT_EQUALS(loaded->getSource()->getPos(), instrument->getSource()->getPos());
+    TS_ASSERT_EQUALS(loaded->getSample()->getName(), "sample");
+
+    const auto detector = loaded->getDetector(5);
+    TS_ASSERT(detector->shape()->hasValidShape());
+    TS_ASSERT_EQUALS(loaded->getParameterMap()->get(detector.get(), "efficiency")->value<double>(), 0.75);
+  }
+
+  void test_parameters_are_rebuilt_bit_for_bit() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    const auto *detector = instrument->getDetector(1).get();
+    auto &parameters = *instrument->getParameterMap();
+    const std::string description = "a value that can not be written with 15 digits";
+    parameters.addDouble(detector, "third", 1. / 3., &description, "false");
+    parameters.addDouble(detector, "tiny", 1e-310);
+    parameters.addInt(detector, "count", -7);
+    parameters.addBool(detector, "flag", true);
+    parameters.addString(detector, "label", " with spaces, and commas ");
+    parameters.addV3D(detector, "offset", Mantid::Kernel::V3D(0.1, 2. / 3., -1e-17));
+    parameters.addQuat(detector, "tilt", Mantid::Kernel::Quat(0.1, Mantid::Kernel::V3D(1., 2., 3.)));
+    const std::string fitting = "0.1234567890123456, Gaussian, Sigma, 0.1, 0.7, , , , , ";
+    parameters.add("fitting", detector, "Sigma", fitting);
+    TS_ASSERT(InstrumentCache::save(*instrument, m_path));
+
+    const auto loaded = InstrumentCache::load(m_path);
+    TS_ASSERT(loaded);
+    const auto &loadedParameters = *loaded->getParameterMap();
+    const auto *loadedDetector = loaded->getDetector(1).get();
+    TS_ASSERT_EQUALS(loadedParameters.size(), parameters.size());
+    for (const auto &name : parameters.names(detector)) {
+      const auto parameter = parameters.get(detector, name);
+      const auto loadedParameter = loadedParameters.get(loadedDetector, name);
+      TS_ASSERT(loadedParameter);
+      TS_ASSERT_EQUALS(loadedParameter->type(), parameter->type());
+      TS_ASSERT_EQUALS(loadedParameter->getDescription(), parameter->getDescription());
+      TS_ASSERT_EQUALS(loadedParameter->visible(), parameter->visible());
+      TS_ASSERT_EQUALS(loadedParameter->asString(), parameter->asString());
+    }
+    const auto bits = [&](const std::string &name) {
+      return std::bit_cast<uint64_t>(loadedParameters.get(loadedDetector, name)->value<double>());
+    };
+    TS_ASSERT_EQUALS(bits("third"), std::bit_cast<uint64_t>(1. / 3.));
+    TS_ASSERT_EQUALS(bits("tiny"), std::bit_cast<uint64_t>(1e-310));
+    const auto offset = loadedParameters.get(loadedDetector, "offset")->value<Mantid::Kernel::V3D>();
+    const auto expectedOffset = parameters.get(detector, "offset")->value<Mantid::Kernel::V3D>();
+    for (size_t i = 0; i < 3; ++i)
+      TS_ASSERT_EQUALS(std::bit_cast<uint64_t>(offset[i]), std::bit_cast<uint64_t>(expectedOffset[i]));
+    const auto tilt = loadedParameters.get(loadedDetector, "tilt")->value<Mantid::Kernel::Quat>();
+    const auto expectedTilt = parameters.get(detector, "tilt")->value<Mantid::Kernel::Quat>();
+    for (int i = 0; i < 4; ++i)
+      TS_ASSERT_EQUALS(std::bit_cast<uint64_t>(tilt[i]), std::bit_cast<uint64_t>(expectedTilt[i]));
+    const auto sigma = loadedParameters.get(loadedDetector, "Sigma")->value<FitParameter>();
+    TS_ASSERT_EQUALS(std::bit_cast<uint64_t>(sigma.getValue()), std::bit_cast<uint64_t>(0.1234567890123456));
+    TS_ASSERT_EQUALS(sigma.getConstraint(), parameters.get(detector, "Sigma")->value<FitParameter>().getConstraint());
+  }
+
+  void test_files_written_by_another_build_are_ignored() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    TS_ASSERT(InstrumentCache::save(*instrument, m_path));
+    std::string contents;
+    {
+      std::ifstream file(m_path, std::ios::binary);
+      contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    const auto version = contents.find(Mantid::Kernel::MantidVersion::revisionFull());
+    TS_ASSERT_DIFFERS(version, std::string::npos);
+    contents[version] = contents[version] == '0' ? '1' : '0';
+    std::ofstream(m_path, std::ios::binary | std::ios::trunc) << contents;
+    TS_ASSERT(!InstrumentCache::load(m_path));
+  }
+
+  void test_instruments_with_rectangular_detectors_are_not_saved() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentRectangular(1, 4);
+    TS_ASSERT(!InstrumentCache::save(*instrument, m_path));
+    TS_ASSERT(!std::filesystem::exists(m_path));
+  }
+
+  void test_missing_or_invalid_files_are_ignored() {
+    TS_ASSERT(!InstrumentCache::load(m_path));
+    std::ofstream(m_path) << "not an instrument";
+    TS_ASSERT(!InstrumentCache::load(m_path));
+  }
+
+  void test_filePath_is_empty_unless_enabled() {
+    auto &config = ConfigService::Instance();
+    const auto enabled = config.getString("instrumentDefinition.binaryCache");
+    config.setString("instrumentDefinition.binaryCache", "Off");
+    TS_ASSERT(InstrumentCache::filePath("BASIC1234").empty());
+    config.setString("instrumentDefinition.binaryCache", "On");
+    TS_ASSERT_EQUALS(std::filesystem::path(InstrumentCache::filePath("BASIC1234")).filename(), "BASIC1234.instrument");
+    config.setString("instrumentDefinition.binaryCache", enabled);
+  }
+
+private:
+  std::string m_path;
+};
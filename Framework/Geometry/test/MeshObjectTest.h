@@ -667,6 +667,17 @@ public:
     TS_ASSERT_EQUALS(geom_obj->isValid(V3D(1.1, 1.1, 1.0)), false);
   }
 
+  void testIsValidManyPointsLShape() {
+    auto geom_obj = createLShape();
+    const std::vector<V3D> points{V3D(0.5, 0.5, 0.5), V3D(1.5, 0.5, 1.0), V3D(1.0, 1.5, 0.5), V3D(0.5, 0.5, 1.5),
+                                  V3D(2.0, 2.0, 0.5), V3D(1.1, 1.1, 0.5)};
+    const auto valid = geom_obj->isValid(points);
+    TS_ASSERT_EQUALS(valid, std::vector<bool>({true, true, true, false, false, false}));
+    for (size_t i = 0; i < points.size(); ++i) {
+      TS_ASSERT_EQUALS(geom_obj->isValid(points[i]), valid[i]);
+    }
+  }
+
   void testCalcValidTypeCube() {
     auto geom_obj = createCube(1.0);
     // entry or exit on the normal
@@ -899,6 +910,19 @@ public:
     auto moved = octahedron->getVertices();
     TS_ASSERT_DELTA(moved, checkVector, 1e-8);
   }
+
+  void testTranslationMovesBoundingBoxAndIntercepts() {
+    auto cube = createCube(1.0);
+    TS_ASSERT_DELTA(cube->getBoundingBox().xMin(), 0.0, 1e-8);
+    cube->translate(V3D(5.0, 0.0, 0.0));
+    TS_ASSERT_DELTA(cube->getBoundingBox().xMin(), 5.0, 1e-8);
+    TS_ASSERT(cube->isValid(V3D(5.5, 0.5, 0.5)));
+    TS_ASSERT(!cube->isValid(V3D(0.5, 0.5, 0.5)));
+    Track track(V3D(0.0, 0.5, 0.5), V3D(1.0, 0.0, 0.0));
+    TS_ASSERT_EQUALS(cube->interceptSurface(track), 1);
+    TS_ASSERT_DELTA(track.cbegin()->entryPoint.X(), 5.0, 1e-8);
+    TS_ASSERT_DELTA(track.cbegin()->exitPoint.X(), 6.0, 1e-8);
+  }
 };
 
 // -----------------------------------------------------------------------------
@@ -126,6 +126,7 @@ template <typename T, typename BinaryOp> void AtomicOp(std::atomic<T> &f, T d, B
 #ifdef _OPENMP
 
 #include "MantidKernel/ConfigService.h"
+#include "MantidKernel/ThreadBudget.h"
 #include <omp.h>
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
@@ -200,6 +201,17 @@ template <typename T, typename BinaryOp> void AtomicOp(std::atomic<T> &f, T d, B
 #define PARALLEL_SECTION PRAGMA(omp section)
 
 inline void setMaxCoresToConfig() {
+  // A budget granted to this thread by an enclosing algorithm takes precedence
+  const int budget = Mantid::Kernel::ThreadBudget::granted();
+  if (budget > 0) {
+    PARALLEL_SET_NUM_THREADS(budget);
+    return;
+  }
+  // The threads of a team share what the team was given
+  if (omp_in_parallel()) {
+    PARALLEL_SET_NUM_THREADS(Mantid::Kernel::ThreadBudget::available());
+    return;
+  }
   const auto maxCores = Mantid::Kernel::ConfigService::Instance().getValue<int>("MultiThreaded.MaxCores");
   if (maxCores.value_or(0) > 0) {
     PARALLEL_SET_NUM_THREADS(maxCores.value());
@@ -0,0 +1,60 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+
+#include <functional>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadBudget : keeps track of how many threads the work running on the
+ * calling thread is allowed to use.
+ *
+ * Budgets are granted hierarchically. A top-level algorithm may use every
+ * core allowed by MultiThreaded.MaxCores. A child algorithm is granted the
+ * budget of its parent, divided between the threads of any OpenMP parallel
+ * region it is executed from, so that nested parallel loops and TBB
+ * algorithms never ask for more threads than the parent was given.
+ *
+ * The OpenMP macros in MultiThreaded.h, ThreadPool and any TBB work started
+ * through ThreadBudget::execute() all respect the budget of the calling thread.
+ */
+class MANTID_KERNEL_DLL ThreadBudget {
+public:
+  /// The budget granted to the calling thread, or 0 if none has been granted
+  static int granted();
+  /// The number of threads the calling thread may use
+  static int available();
+  /// The budget for work started by the calling thread from @p parentBudget
+  static int forNestedWork(const int parentBudget);
+  /// Run @p work on the calling thread with @p budget threads available to it
+  static void execute(const int budget, const std::function<void()> &work);
+
+  /** Sets the budget of the calling thread for the lifetime of the object and
+   * restores the previous budget on destruction.
+   */
+  class MANTID_KERNEL_DLL Scope {
+  public:
+    explicit Scope(const int budget);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    /// The budget in place before this scope was entered
+    const int m_previous;
+    /// The number of threads for OpenMP parallel regions before the scope was entered
+    const int m_previousThreads;
+    /// The maximum number of active nested parallel regions before the scope was entered
+    int m_previousActiveLevels;
+  };
+};
+
+} // namespace Kernel
+} // namespace Mantid
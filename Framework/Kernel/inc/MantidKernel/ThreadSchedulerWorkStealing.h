@@ -0,0 +1,80 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : a ThreadScheduler that keeps a separate
+ * queue of tasks for every thread of the ThreadPool instead of a single
+ * queue shared by all of them.
+ *
+ * Tasks pushed by a thread of the pool (e.g. the recursive box splitting
+ * tasks of MDGridBox::splitAllIfNeeded) go to the queue of that thread and
+ * are run last-in-first-out, so they are likely to find their data still in
+ * the cache. Tasks pushed from any other thread are spread round-robin over
+ * the queues. A thread whose queue is empty steals the oldest task from the
+ * queue with the largest total Task::cost().
+ *
+ * Each queue has its own lock, which is only contended when a task is
+ * stolen, so fine-grained tasks no longer serialise on one lock.
+ *
+ * totalCost() and totalCostExecuted() are not tracked by this scheduler as
+ * that would need a lock shared between all queues.
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(std::shared_ptr<Task> newTask) override;
+  std::shared_ptr<Task> pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override final;
+
+  /// @return the number of per-thread queues
+  size_t numQueues() const { return m_queues.size(); }
+
+private:
+  /// A queue of tasks owned by one thread. Aligned to keep queues of different
+  /// threads on separate cache lines.
+  struct alignas(64) Queue {
+    /// Protects tasks
+    std::mutex lock;
+    /// The tasks; the owner takes from the back, thieves from the front.
+    std::deque<std::shared_ptr<Task>> tasks;
+    /// Number of tasks, read by thieves without taking the lock
+    std::atomic<size_t> numTasks{0};
+    /// Total cost of the tasks, read by thieves without taking the lock
+    std::atomic<double> cost{0.};
+  };
+
+  size_t queueForPush();
+  std::shared_ptr<Task> popBack(Queue &queue);
+  std::shared_ptr<Task> take(Queue &queue, std::shared_ptr<Task> task);
+  std::shared_ptr<Task> steal(size_t thiefIndex);
+
+  /// One queue per thread
+  std::vector<Queue> m_queues;
+  /// Number of tasks in all of the queues
+  std::atomic<size_t> m_numTasks;
+  /// Next queue for tasks pushed from outside the pool
+  std::atomic<size_t> m_nextQueue;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -64,6 +64,11 @@ public:
     return *this;
   }
   cow_ptr<DataType> &operator=(const ptr_type &) noexcept;
+  /// Releases the data object, leaving the cow_ptr empty
+  cow_ptr<DataType> &operator=(std::nullptr_t) noexcept {
+    Data.reset();
+    return *this;
+  }
 
   /// Returns the stored pointer.
   const DataType *get() const noexcept { return Data.get(); }
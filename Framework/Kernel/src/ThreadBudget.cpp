@@ -0,0 +1,119 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadBudget.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <tbb/task_arena.h>
+
+#include <algorithm>
+#include <thread>
+
+namespace Mantid::Kernel {
+
+namespace {
+/// Budget of the calling thread. 0 means no budget has been granted.
+thread_local int g_threadBudget = 0;
+
+/// The number of threads available to a thread without a budget
+int machineThreads() {
+  const auto maxCores = ConfigService::Instance().getValue<int>("MultiThreaded.MaxCores");
+  if (maxCores.value_or(0) > 0)
+    return maxCores.value();
+#ifdef _OPENMP
+  // respects OMP_NUM_THREADS when MultiThreaded.MaxCores is not set
+  return std::max(1, omp_get_max_threads());
+#else
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+#endif
+}
+} // namespace
+
+/** @return the budget granted to the calling thread by an enclosing Scope, or 0
+ * if the thread is not running under a budget.
+ */
+int ThreadBudget::granted() { return g_threadBudget; }
+
+/** @return the number of threads the calling thread may use. This is the
+ * granted budget or, if there is none, the MultiThreaded.MaxCores setting
+ * falling back to the default number of threads. A thread of a parallel team
+ * without a budget of its own shares that number with the other threads of
+ * every team enclosing it.
+ */
+int ThreadBudget::available() {
+  if (g_threadBudget > 0)
+    return g_threadBudget;
+  int threads = machineThreads();
+#ifdef _OPENMP
+  for (int level = 1; level <= omp_get_level(); ++level)
+    threads /= std::max(1, omp_get_team_size(level));
+#endif
+  return std::max(1, threads);
+}
+
+/** Work started from inside an OpenMP parallel region shares the budget of the
+ * region with the other threads of the team.
+ * @param parentBudget :: the budget of the work that encloses the new work
+ * @return the budget for the new work; always at least 1.
+ */
+int ThreadBudget::forNestedWork(const int parentBudget) {
+  if (parentBudget <= 0)
+    return available();
+  int budget = parentBudget;
+#ifdef _OPENMP
+  if (omp_in_parallel())
+    budget /= omp_get_num_threads();
+#endif
+  return std::max(1, budget);
+}
+
+/** Runs some work on the calling thread under a budget. When the budget is
+ * smaller than the TBB concurrency the work is run inside a task_arena of that
+ * size so that any TBB parallel algorithms it uses are limited too.
+ * @param budget :: the number of threads the work may use
+ * @param work :: the work to run. Any exception it throws is propagated.
+ */
+void ThreadBudget::execute(const int budget, const std::function<void()> &work) {
+  Scope scope(budget);
+  if (budget > 0 && budget < tbb::this_task_arena::max_concurrency()) {
+    tbb::task_arena arena(budget);
+    arena.execute(work);
+  } else {
+    work();
+  }
+}
+
+/** Grants a budget to the calling thread.
+ * @param budget :: the number of threads the calling thread may use
+ */
+ThreadBudget::Scope::Scope(const int budget)
+    : m_previous(g_threadBudget), m_previousThreads(PARALLEL_GET_MAX_THREADS), m_previousActiveLevels(0) {
+  g_threadBudget = budget;
+#ifdef _OPENMP
+  // Nested parallel regions are inactive by default so a budget larger than one
+  // granted from inside a parallel region would otherwise go unused. Only one
+  // more level is activated: the threads of the nested team have no budget of
+  // their own and any region they start stays inactive.
+  m_previousActiveLevels = omp_get_max_active_levels();
+  if (budget > 1 && omp_in_parallel() && m_previousActiveLevels <= omp_get_active_level())
+    omp_set_max_active_levels(omp_get_active_level() + 1);
+#endif
+}
+
+/// Restores the budget in place before the scope was entered
+ThreadBudget::Scope::~Scope() {
+  g_threadBudget = m_previous;
+  // Regions created after leaving the scope must not inherit the thread count
+  // or the nesting that were set for the budgeted work.
+  PARALLEL_SET_NUM_THREADS(m_previousThreads)
+#ifdef _OPENMP
+  if (omp_get_max_active_levels() != m_previousActiveLevels)
+    omp_set_max_active_levels(m_previousActiveLevels);
+#endif
+}
+
+} // namespace Mantid::Kernel
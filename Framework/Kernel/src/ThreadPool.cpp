@@ -13,6 +13,7 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/ThreadPoolRunnable.h"
 
 #include <Poco/Thread.h>
@@ -62,6 +63,7 @@ ThreadPool::~ThreadPool() = default;
 //--------------------------------------------------------------------------------
 /** Return the number of physical cores available on the system.
  * NOTE: Uses OPENMP or Poco::Environment::processorCount() to find the number.
+ * The number is limited by any ThreadBudget granted to the calling thread.
  * @return how many cores are present.
  */
 size_t ThreadPool::getNumPhysicalCores() {
@@ -71,6 +73,10 @@ size_t ThreadPool::getNumPhysicalCores() {
 #else
   int physicalCores = PARALLEL_GET_MAX_THREADS;
 #endif
+  // Do not use more threads than the calling algorithm has been granted
+  const int budget = ThreadBudget::granted();
+  if (budget > 0)
+    physicalCores = std::min(budget, physicalCores);
 
   auto maxCores = Kernel::ConfigService::Instance().getValue<int>("MultiThreaded.MaxCores");
 
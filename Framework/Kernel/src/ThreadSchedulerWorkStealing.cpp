@@ -0,0 +1,168 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <algorithm>
+
+namespace Mantid::Kernel {
+
+namespace {
+/// The scheduler whose pop() was last called by this thread
+thread_local const ThreadSchedulerWorkStealing *t_scheduler = nullptr;
+/// The queue owned by this thread in t_scheduler
+thread_local size_t t_queueIndex = 0;
+} // namespace
+
+/** Constructor
+ * @param numQueues :: number of per-thread queues. This should match the
+ *        number of threads in the ThreadPool; default = 0, meaning the number
+ *        of cores a ThreadPool would use.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : ThreadScheduler(),
+      m_queues(std::max(numQueues > 0 ? numQueues : ThreadPool::getNumPhysicalCores(), size_t{1})), m_numTasks(0),
+      m_nextQueue(0) {}
+
+/// Destructor
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() {
+  clear();
+  // Do not mistake a new scheduler created at the same address for this one
+  if (t_scheduler == this)
+    t_scheduler = nullptr;
+}
+
+//-------------------------------------------------------------------------------
+/** Add a Task to the queue of the calling thread, or to the next queue in turn
+ * if the calling thread does not belong to the pool using this scheduler.
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::push(std::shared_ptr<Task> newTask) {
+  Queue &queue = m_queues[queueForPush()];
+  const double cost = newTask->cost();
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.emplace_back(std::move(newTask));
+  queue.cost.store(queue.cost.load(std::memory_order_relaxed) + cost, std::memory_order_relaxed);
+  ++queue.numTasks;
+  ++m_numTasks;
+}
+
+//-------------------------------------------------------------------------------
+/** Retrieve the newest task of the calling thread's own queue or, if that is
+ * empty, steal one from another thread.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or nullptr if there are no tasks.
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t index = threadnum % m_queues.size();
+  // Remember the queue of this thread so that tasks it pushes stay local
+  t_scheduler = this;
+  t_queueIndex = index;
+  if (auto task = popBack(m_queues[index]))
+    return task;
+  return steal(index);
+}
+
+//-------------------------------------------------------------------------------
+/// @return the number of tasks in all queues
+size_t ThreadSchedulerWorkStealing::size() { return m_numTasks.load(); }
+
+//-------------------------------------------------------------------------------
+/// @return true if all queues are empty
+bool ThreadSchedulerWorkStealing::empty() { return m_numTasks.load() == 0; }
+
+//-------------------------------------------------------------------------------
+/// Empty out all of the queues
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue.lock);
+    m_numTasks -= queue.tasks.size();
+    queue.tasks.clear();
+    queue.numTasks = 0;
+    queue.cost = 0.;
+  }
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+//-------------------------------------------------------------------------------
+/// @return the index of the queue that a task pushed by the calling thread goes to
+size_t ThreadSchedulerWorkStealing::queueForPush() {
+  if (t_scheduler == this)
+    return t_queueIndex % m_queues.size();
+  return m_nextQueue++ % m_queues.size();
+}
+
+//-------------------------------------------------------------------------------
+/** Take the newest task from a queue
+ * @param queue :: the queue to take it from
+ * @return the task or nullptr if the queue is empty
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::popBack(Queue &queue) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  auto task = std::move(queue.tasks.back());
+  queue.tasks.pop_back();
+  return take(queue, std::move(task));
+}
+
+//-------------------------------------------------------------------------------
+/** Update the book-keeping for a task that has been removed from a queue.
+ * Must be called with the lock of the queue held.
+ * @param queue :: the queue the task was removed from
+ * @param task :: the task
+ * @return the task
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::take(Queue &queue, std::shared_ptr<Task> task) {
+  // Reset to exactly zero when empty so rounding errors can not accumulate
+  queue.cost.store(queue.tasks.empty() ? 0. : queue.cost.load(std::memory_order_relaxed) - task->cost(),
+                   std::memory_order_relaxed);
+  --queue.numTasks;
+  --m_numTasks;
+  return task;
+}
+
+//-------------------------------------------------------------------------------
+/** Steal the oldest task from the queue with the largest total cost. The
+ * oldest task of a queue is taken as, for recursive work, it is usually the
+ * one that will spawn the most work of its own.
+ * @param thiefIndex :: the index of the queue of the stealing thread
+ * @return the stolen task or nullptr if all queues are empty
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::steal(size_t thiefIndex) {
+  const size_t numQueues = m_queues.size();
+  // The costs are read without locking so the chosen victim may have been
+  // emptied in the meantime; try again while there is work anywhere.
+  for (size_t attempt = 0; attempt < numQueues && !empty(); ++attempt) {
+    size_t victim = thiefIndex;
+    double largestCost = -1.;
+    for (size_t offset = 1; offset < numQueues; ++offset) {
+      const size_t index = (thiefIndex + offset) % numQueues;
+      Queue &queue = m_queues[index];
+      // Tasks may have zero or negative cost so check that there are tasks at all
+      const double cost = queue.cost.load(std::memory_order_relaxed);
+      if (cost > largestCost && queue.numTasks.load() > 0) {
+        largestCost = cost;
+        victim = index;
+      }
+    }
+    if (victim == thiefIndex)
+      return popBack(m_queues[thiefIndex]);
+
+    Queue &queue = m_queues[victim];
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (queue.tasks.empty())
+      continue;
+    auto task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    return take(queue, std::move(task));
+  }
+  return nullptr;
+}
+
+} // namespace Mantid::Kernel
@@ -0,0 +1,107 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ThreadBudget.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <cxxtest/TestSuite.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using Mantid::Kernel::ThreadBudget;
+using Mantid::Kernel::ThreadPool;
+
+class ThreadBudgetTest : public CxxTest::TestSuite {
+public:
+  void test_no_budget_is_granted_by_default() {
+    TS_ASSERT_EQUALS(ThreadBudget::granted(), 0);
+    TS_ASSERT_LESS_THAN_EQUALS(1, ThreadBudget::available());
+  }
+
+  void test_scope_grants_and_restores_budget() {
+    {
+      ThreadBudget::Scope outer(4);
+      TS_ASSERT_EQUALS(ThreadBudget::granted(), 4);
+      TS_ASSERT_EQUALS(ThreadBudget::available(), 4);
+      {
+        ThreadBudget::Scope inner(2);
+        TS_ASSERT_EQUALS(ThreadBudget::available(), 2);
+      }
+      TS_ASSERT_EQUALS(ThreadBudget::available(), 4);
+    }
+    TS_ASSERT_EQUALS(ThreadBudget::granted(), 0);
+  }
+
+  void test_nested_work_outside_parallel_region_keeps_parent_budget() {
+    TS_ASSERT_EQUALS(ThreadBudget::forNestedWork(6), 6);
+  }
+
+  void test_nested_work_is_always_granted_one_thread() {
+    TS_ASSERT_LESS_THAN_EQUALS(1, ThreadBudget::forNestedWork(0));
+  }
+
+  void test_nested_work_inside_parallel_region_shares_parent_budget() {
+    int budget = 0;
+    int numThreads = 1;
+    PARALLEL {
+      PARALLEL_CRITICAL(ThreadBudgetTest) {
+        budget = ThreadBudget::forNestedWork(8);
+        numThreads = PARALLEL_NUMBER_OF_THREADS;
+      }
+    }
+    TS_ASSERT_EQUALS(budget, std::max(1, 8 / numThreads));
+  }
+
+  void test_threads_without_budget_share_the_threads_of_their_team() {
+    const int outside = ThreadBudget::available();
+    int inside = 0;
+    int numThreads = 1;
+    PARALLEL {
+      PARALLEL_CRITICAL(ThreadBudgetTest) {
+        inside = ThreadBudget::available();
+        numThreads = PARALLEL_NUMBER_OF_THREADS;
+      }
+    }
+    TS_ASSERT_EQUALS(inside, std::max(1, outside / numThreads));
+  }
+
+#ifdef _OPENMP
+  void test_scope_restores_nesting_of_parallel_regions() {
+    int before = 0;
+    int after = -1;
+    PARALLEL {
+      PARALLEL_CRITICAL(ThreadBudgetTest) {
+        before = omp_get_max_active_levels();
+        { ThreadBudget::Scope scope(4); }
+        after = omp_get_max_active_levels();
+      }
+    }
+    TS_ASSERT_EQUALS(after, before);
+  }
+#endif
+
+  void test_execute_runs_work_under_budget() {
+    int seen = 0;
+    ThreadBudget::execute(1, [&seen]() { seen = ThreadBudget::granted(); });
+    TS_ASSERT_EQUALS(seen, 1);
+    TS_ASSERT_EQUALS(ThreadBudget::granted(), 0);
+  }
+
+  void test_execute_propagates_exceptions_and_restores_budget() {
+    auto failingWork = []() { throw std::runtime_error("failed"); };
+    TS_ASSERT_THROWS(ThreadBudget::execute(1, failingWork), const std::runtime_error &);
+    TS_ASSERT_EQUALS(ThreadBudget::granted(), 0);
+  }
+
+  void test_thread_pool_respects_budget() {
+    ThreadBudget::Scope scope(1);
+    TS_ASSERT_EQUALS(ThreadPool::getNumPhysicalCores(), 1);
+  }
+};
@@ -0,0 +1,106 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2026 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <atomic>
+#include <memory>
+
+using namespace Mantid::Kernel;
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  class TaskWithCost : public Task {
+  public:
+    TaskWithCost(double cost) : Task(cost) {}
+    void run() override {}
+  };
+
+  void test_push_and_clear() {
+    ThreadSchedulerWorkStealing sc(2);
+    TS_ASSERT_EQUALS(sc.numQueues(), 2);
+    TS_ASSERT(sc.empty());
+    sc.push(std::make_shared<TaskWithCost>(1.0));
+    sc.push(std::make_shared<TaskWithCost>(1.0));
+    sc.push(std::make_shared<TaskWithCost>(1.0));
+    TS_ASSERT_EQUALS(sc.size(), 3);
+    TS_ASSERT(!sc.empty());
+    sc.clear();
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT(sc.empty());
+  }
+
+  void test_default_number_of_queues_is_at_least_one() {
+    ThreadSchedulerWorkStealing sc;
+    TS_ASSERT_LESS_THAN_EQUALS(1, sc.numQueues());
+  }
+
+  void test_external_pushes_are_spread_over_queues_and_stolen() {
+    ThreadSchedulerWorkStealing sc(2);
+    // Round-robin puts costs 1 and 3 in queue 0 and cost 2 in queue 1
+    sc.push(std::make_shared<TaskWithCost>(1.0));
+    sc.push(std::make_shared<TaskWithCost>(2.0));
+    sc.push(std::make_shared<TaskWithCost>(3.0));
+    // Threads take the newest task of their own queue first
+    TS_ASSERT_EQUALS(sc.pop(0)->cost(), 3.0);
+    TS_ASSERT_EQUALS(sc.pop(1)->cost(), 2.0);
+    // Queue 1 is now empty so its thread steals from queue 0
+    TS_ASSERT_EQUALS(sc.pop(1)->cost(), 1.0);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT(!sc.pop(0));
+  }
+
+  void test_steals_oldest_task_from_most_expensive_queue() {
+    ThreadSchedulerWorkStealing sc(3);
+    sc.push(std::make_shared<TaskWithCost>(1.0));  // queue 0
+    sc.push(std::make_shared<TaskWithCost>(5.0));  // queue 1
+    sc.push(std::make_shared<TaskWithCost>(10.0)); // queue 2
+    sc.push(std::make_shared<TaskWithCost>(1.0));  // queue 0
+    sc.push(std::make_shared<TaskWithCost>(6.0));  // queue 1
+    // Queue 1 has a total cost of 11; its oldest task is stolen by thread 0
+    TS_ASSERT_EQUALS(sc.pop(0)->cost(), 1.0);
+    TS_ASSERT_EQUALS(sc.pop(0)->cost(), 1.0);
+    TS_ASSERT_EQUALS(sc.pop(0)->cost(), 5.0);
+    TS_ASSERT_EQUALS(sc.size(), 2);
+  }
+
+  void test_tasks_pushed_by_a_worker_stay_in_its_queue() {
+    ThreadSchedulerWorkStealing sc(2);
+    sc.push(std::make_shared<TaskWithCost>(1.0));
+    // The first pop by thread 1 steals and makes this thread a worker of queue 1
+    TS_ASSERT(sc.pop(1));
+    sc.push(std::make_shared<TaskWithCost>(2.0));
+    sc.push(std::make_shared<TaskWithCost>(3.0));
+    TS_ASSERT_EQUALS(sc.pop(1)->cost(), 3.0);
+    TS_ASSERT_EQUALS(sc.pop(1)->cost(), 2.0);
+  }
+
+  void test_thread_pool_runs_recursively_pushed_tasks() {
+    auto *sc = new ThreadSchedulerWorkStealing(4);
+    ThreadPool pool(sc, 4);
+    std::atomic<size_t> count{0};
+    std::function<void(int)> spawn = [&](int depth) {
+      ++count;
+      if (depth > 0) {
+        for (int i = 0; i < 4; ++i)
+          sc->push(std::make_shared<FunctionTask>([&spawn, depth]() { spawn(depth - 1); }));
+      }
+    };
+    pool.schedule(std::make_shared<FunctionTask>([&spawn]() { spawn(4); }));
+    pool.joinAll();
+    // Threads can exit before recursive tasks are pushed, finish anything left over
+    while (!sc->empty())
+      pool.joinAll();
+    // 1 + 4 + 16 + 64 + 256 tasks
+    TS_ASSERT_EQUALS(count.load(), 341);
+  }
+};
@@ -7,6 +7,7 @@
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
 #include "MantidAPI/Run.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
 namespace Mantid::MDAlgorithms {
@@ -203,7 +204,7 @@ void ConvToMDEventsWS::appendEventsFromInputWS(API::Progress *pProgress, const A
   size_t lastNumBoxes = bc->getTotalNumMDBoxes();
   size_t nEventsInWS = m_OutWSWrapper->pWorkspace()->getNPoints();
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadSchedulerWorkStealing *ts(nullptr);
 
   int nThreads(m_NumThreads);
   if (nThreads < 0)
@@ -214,7 +215,7 @@ void ConvToMDEventsWS::appendEventsFromInputWS(API::Progress *pProgress, const A
     runMultithreaded = true;
     // Create the thread pool that will run all of these. It will be deleted by
     // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    ts = new Kernel::ThreadSchedulerWorkStealing(static_cast<size_t>(nThreads));
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
     pProgress->resetNumSteps(m_NSpectra, 0, 1);
@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/ConvToMDHistoWS.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 
 namespace Mantid::MDAlgorithms {
 // service variable used for efficient filling of the MD event WS  -> should be
@@ -170,7 +171,7 @@ void ConvToMDHistoWS::runConversion(API::Progress *pProgress) {
     return;
 
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadSchedulerWorkStealing *ts(nullptr);
   int nThreads(m_NumThreads);
   if (nThreads < 0)
     nThreads = 0; // negative m_NumThreads correspond to all cores used, 0 no
@@ -180,7 +181,7 @@ void ConvToMDHistoWS::runConversion(API::Progress *pProgress) {
     runMultithreaded = true;
     // Create the thread pool that will run all of these.  It will be deleted by
     // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    ts = new Kernel::ThreadSchedulerWorkStealing(static_cast<size_t>(nThreads));
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
     pProgress->resetNumSteps(nValidSpectra, 0, 1);
@@ -87,6 +87,8 @@ public:
   double activeParameter(size_t i) const override;
   /// Override this method to make fitted parameters different from the declared
   void setActiveParameter(size_t i, double value) override;
+  /// Python functions need the GIL, which the evaluating thread may hold
+  bool threadSafe() const override { return false; }
 
 protected:
   /// @returns The PyObject that owns this wrapper, i.e. self
@@ -69,6 +69,9 @@ void export_AlgorithmHistory() {
       .def("execCount", &AlgorithmHistory::execCount, arg("self"), return_value_policy<copy_const_reference>(),
            "Returns the execution number of the algorithm.")
 
+      .def("repeatCount", &AlgorithmHistory::repeatCount, arg("self"),
+           "Returns the number of consecutive identical executions this record stands for.")
+
       .def("childHistorySize", &AlgorithmHistory::childHistorySize, arg("self"),
            "Returns the number of the child algorithms.")
 